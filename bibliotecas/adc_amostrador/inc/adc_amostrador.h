@@ -0,0 +1,65 @@
+#ifndef ADC_AMOSTRADOR_H
+#define ADC_AMOSTRADOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_decimador.h"
+
+// Serviço único de amostragem do ADC: o ADC roda em modo livre com o rodízio
+// (round-robin) dos canais pedidos, o DMA enche blocos intercalados e a
+// interrupção distribui cada código no anel do seu canal. Quem consome lê a
+// última amostra ou o bloco novo do anel, sem selecionar canal nem esperar
+// conversão. Cada canal pode ter a sua decimação (adc_decimador.h): as
+// amostras guardam os bits ganhos com a média, em Q12.F.
+
+#define ADC_AMOSTRADOR_CANAIS 5         // AIN0..AIN3 (GPIO 26..29) e AIN4
+#define ADC_AMOSTRADOR_ANEL 64          // Amostras guardadas por canal (potência de 2)
+#define ADC_CANAL_TEMPERATURA 4         // Sensor interno
+
+#define ADC_MASCARA(canal) (1u << (canal))
+
+// Decimação de um canal (adc_decimador.h); ordem 0 = sem decimação.
+typedef struct {
+    uint8_t ordem;
+    uint8_t log2_fator;
+} adc_decimacao_t;
+
+// Leitor de blocos de um canal: cada leitor tem a sua posição no anel e conta
+// as amostras que o ADC reescreveu antes de serem lidas.
+typedef struct {
+    uint8_t canal;
+    uint32_t proxima;               // Índice da próxima amostra a ler
+    uint32_t perdidas;
+} adc_leitor_t;
+
+// Núcleo (Pico e host). A decimação só muda com a captura parada: no Pico,
+// pelo parâmetro de adc_amostrador_iniciar().
+bool adc_amostrador_configurar(uint8_t mascara);
+bool adc_amostrador_decimacao(uint8_t canal, uint8_t ordem, uint8_t log2_fator);
+void adc_amostrador_distribuir(const uint16_t *codigos, uint32_t quantidade);
+void adc_amostrador_ressincronizar(void);
+uint8_t adc_amostrador_rodizio(uint8_t *ordem);
+uint16_t adc_amostrador_ultimo(uint8_t canal);
+int32_t adc_amostrador_ultimo_fino(uint8_t canal);
+uint8_t adc_amostrador_bits_frac(uint8_t canal);
+uint32_t adc_amostrador_escritas(uint8_t canal);
+bool adc_amostrador_tem_amostra(uint8_t canal);     // Antes da primeira, ultimo() dá 0
+
+void adc_leitor_iniciar(adc_leitor_t *leitor, uint8_t canal);
+uint32_t adc_leitor_ler(adc_leitor_t *leitor, int32_t *destino, uint32_t maximo);
+
+// Só com o Pico SDK: 'taxa_hz' é a taxa de cada canal antes da decimação (o
+// ADC converte taxa_hz vezes o número de canais por segundo, até 500 kS/s).
+// 'decimacao' tem uma entrada por canal (índice = canal) ou é NULL; vale desde
+// a primeira amostra. Usa dois canais DMA livres e o DMA_IRQ_1 compartilhado.
+bool adc_amostrador_iniciar(uint8_t mascara, uint32_t taxa_hz, const adc_decimacao_t *decimacao);
+void adc_amostrador_parar(void);
+uint32_t adc_amostrador_estouros_fifo(void);
+
+// Só no host: modelo do ADC. Gera 'ciclos' voltas do rodízio com os códigos
+// de 'sinal' ('indice' = volta do rodízio nesta chamada) e entrega em blocos,
+// como o DMA, para adc_amostrador_distribuir().
+typedef uint16_t (*adc_sinal_t)(uint8_t canal, uint32_t indice, void *contexto);
+void adc_amostrador_simular(uint32_t ciclos, adc_sinal_t sinal, void *contexto);
+
+#endif // ADC_AMOSTRADOR_H
@@ -0,0 +1,42 @@
+#ifndef ADC_DECIMADOR_H
+#define ADC_DECIMADOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Filtro CIC (ordem 1 = média em bloco, boxcar) que decima por R = 2^log2_fator
+// e guarda os bits ganhos com a sobreamostragem em vez de arredondar para 12.
+//
+// Resolução: com ruído branco de ~1 LSB ou mais na entrada, cada quadruplicação
+// de R rende 1 bit, então ENOB_saida ≈ ENOB_ADC + log2_fator / 2 (o ADC do
+// RP2040 tem ENOB ≈ 8,7 bits). A saída é o código médio em ponto fixo Q12.F,
+// com F = log2_fator / 2 bits fracionários. Erros estáticos (DNL do ADC,
+// offset e inclinação do sensor) não diminuem com a média.
+//
+// Custo: 'ordem' somas de 32 bits por entrada e 'ordem' subtrações por saída.
+// Os registradores dão a volta em 32 bits sem erro enquanto 12 + ordem *
+// log2_fator <= 31 (ordem 1 até R = 2^19, ordem 2 até 2^9, ordem 3 até 2^6).
+// Nas ordens 2 e 3 as primeiras 'ordem - 1' saídas são transitórias.
+
+#define ADC_DECIMADOR_ORDEM_MAX 3
+
+typedef struct {
+    uint8_t ordem;
+    uint8_t log2_fator;
+    uint8_t bits_frac;              // F: bits fracionários da saída
+    uint32_t contador;              // Entradas desde a última saída
+    uint32_t integradores[ADC_DECIMADOR_ORDEM_MAX];
+    uint32_t pentes[ADC_DECIMADOR_ORDEM_MAX];   // Entrada anterior de cada pente
+} adc_decimador_t;
+
+bool adc_decimador_iniciar(adc_decimador_t *decimador, uint8_t ordem, uint8_t log2_fator);
+void adc_decimador_zerar(adc_decimador_t *decimador);
+bool adc_decimador_entrar(adc_decimador_t *decimador, uint16_t codigo, int32_t *saida);
+uint32_t adc_decimador_bloco(adc_decimador_t *decimador, const uint16_t *codigos, uint32_t quantidade,
+                             int32_t *saidas, uint32_t maximo);
+
+// Sensor interno: código em Q12.F para milésimos de grau Celsius, só com
+// inteiros (fórmula do datasheet: 27 - (V - 0,706) / 0,001721).
+int32_t adc_temperatura_mc(int32_t codigo, uint8_t bits_frac);
+
+#endif // ADC_DECIMADOR_H
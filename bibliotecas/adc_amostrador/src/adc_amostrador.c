@@ -0,0 +1,147 @@
+/**
+ * adc_amostrador.c
+ *
+ * ADC em modo livre com rodízio de canais e dois canais DMA em ping-pong:
+ * enquanto um enche a sua metade, a interrupção rearma e distribui a outra.
+ */
+
+#include "adc_amostrador.h"
+#include "pico/stdlib.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+#define CICLOS_POR_BLOCO 16                 // Voltas do rodízio por metade
+#define CLOCK_ADC_HZ 48000000u
+#define CICLOS_CONVERSAO 96                 // 500 kS/s no máximo
+
+static uint16_t bruto[2][ADC_AMOSTRADOR_CANAIS * CICLOS_POR_BLOCO];
+static dma_channel_config cfg_dma[2];
+static int canal_dma[2] = { -1, -1 };
+static uint32_t transferencias = 0;         // Códigos por metade
+static uint8_t primeiro = 0;                // Canal que abre o rodízio
+static uint8_t proxima_metade = 0;
+static volatile uint32_t estouros_fifo = 0;
+
+// Aborta os dois de uma vez: um aborto isolado poderia disparar o par encadeado.
+static void abortar_canais(void) {
+    uint32_t mascara = (1u << canal_dma[0]) | (1u << canal_dma[1]);
+    dma_hw->abort = mascara;
+    while (dma_hw->abort & mascara) tight_loop_contents();
+    dma_hw->ints1 = mascara;
+}
+
+// --------------------------------------------------------------
+// Recomeça a captura do primeiro canal do rodízio. Também usado
+// depois de um estouro da FIFO, quando a fase se perdeu
+// --------------------------------------------------------------
+static void recomecar(void) {
+    adc_run(false);
+    abortar_canais();
+    adc_fifo_drain();
+    adc_hw->fcs = ADC_FCS_OVER_BITS | ADC_FCS_UNDER_BITS;
+
+    adc_select_input(primeiro);
+    adc_amostrador_ressincronizar();
+    proxima_metade = 0;
+
+    dma_channel_configure(canal_dma[1], &cfg_dma[1], bruto[1], &adc_hw->fifo, transferencias, false);
+    dma_channel_configure(canal_dma[0], &cfg_dma[0], bruto[0], &adc_hw->fifo, transferencias, true);
+    adc_run(true);
+}
+
+// Handler do DMA_IRQ_1 (compartilhado): distribui as metades na ordem em que terminaram.
+static void dma_handler_amostrador(void) {
+    while (dma_channel_get_irq1_status(canal_dma[proxima_metade])) {
+        int canal = canal_dma[proxima_metade];
+        dma_channel_acknowledge_irq1(canal);
+
+        // O outro canal já começou (encadeamento): esta metade volta ao início
+        dma_channel_set_write_addr(canal, bruto[proxima_metade], false);
+        adc_amostrador_distribuir(bruto[proxima_metade], transferencias);
+        proxima_metade ^= 1;
+    }
+
+    if (adc_hw->fcs & ADC_FCS_OVER_BITS) {
+        estouros_fifo++;
+        recomecar();
+    }
+}
+
+static dma_channel_config config_canal(int canal, int par) {
+    dma_channel_config cfg = dma_channel_get_default_config(canal);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);  // 16 bits
+    channel_config_set_read_increment(&cfg, false);            // ADC FIFO fixo
+    channel_config_set_write_increment(&cfg, true);            // Buffer se move
+    channel_config_set_dreq(&cfg, DREQ_ADC);                   // dispara com ADC
+    channel_config_set_chain_to(&cfg, par);                    // Ping-pong
+    return cfg;
+}
+
+// --------------------------------------------------------------
+// Configura os canais pedidos e começa a captura contínua.
+// Os GPIOs analógicos e o sensor de temperatura são habilitados
+// conforme a máscara. A decimação entra antes do primeiro bloco:
+// depois, a interrupção já usa os decimadores
+// --------------------------------------------------------------
+bool adc_amostrador_iniciar(uint8_t mascara, uint32_t taxa_hz, const adc_decimacao_t *decimacao) {
+    if (canal_dma[0] >= 0) adc_amostrador_parar();
+    if (taxa_hz == 0 || !adc_amostrador_configurar(mascara)) return false;
+
+    for (uint8_t c = 0; decimacao && c < ADC_AMOSTRADOR_CANAIS; c++) {
+        if (decimacao[c].ordem == 0) continue;
+        if (!adc_amostrador_decimacao(c, decimacao[c].ordem, decimacao[c].log2_fator)) return false;
+    }
+
+    uint8_t ordem[ADC_AMOSTRADOR_CANAIS];
+    uint8_t quantidade = adc_amostrador_rodizio(ordem);
+    primeiro = ordem[0];
+    transferencias = quantidade * CICLOS_POR_BLOCO;
+
+    adc_init();
+    for (uint8_t c = 0; c < ADC_CANAL_TEMPERATURA; c++) {
+        if (mascara & ADC_MASCARA(c)) adc_gpio_init(26 + c);
+    }
+    adc_set_temp_sensor_enabled(mascara & ADC_MASCARA(ADC_CANAL_TEMPERATURA));
+
+    // Período do ADC = 1 + divisor ciclos de 48 MHz (mínimo de 96)
+    float divisor = (float)CLOCK_ADC_HZ / ((float)taxa_hz * quantidade) - 1.0f;
+    if (divisor < CICLOS_CONVERSAO - 1) divisor = 0;        // Velocidade máxima
+    if (divisor > 65535.0f) divisor = 65535.0f;
+    adc_set_clkdiv(divisor);
+    adc_set_round_robin(mascara);
+    adc_fifo_setup(true, true, 1, false, false);
+
+    canal_dma[0] = dma_claim_unused_channel(true);
+    canal_dma[1] = dma_claim_unused_channel(true);
+    cfg_dma[0] = config_canal(canal_dma[0], canal_dma[1]);
+    cfg_dma[1] = config_canal(canal_dma[1], canal_dma[0]);
+
+    dma_channel_set_irq1_enabled(canal_dma[0], true);
+    dma_channel_set_irq1_enabled(canal_dma[1], true);
+    irq_add_shared_handler(DMA_IRQ_1, dma_handler_amostrador, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    recomecar();
+    return true;
+}
+
+void adc_amostrador_parar(void) {
+    if (canal_dma[0] < 0) return;
+
+    adc_run(false);
+    adc_set_round_robin(0);
+    dma_channel_set_irq1_enabled(canal_dma[0], false);
+    dma_channel_set_irq1_enabled(canal_dma[1], false);
+    abortar_canais();
+    irq_remove_handler(DMA_IRQ_1, dma_handler_amostrador);
+    dma_channel_unclaim(canal_dma[0]);
+    dma_channel_unclaim(canal_dma[1]);
+    adc_fifo_drain();
+
+    canal_dma[0] = canal_dma[1] = -1;
+}
+
+uint32_t adc_amostrador_estouros_fifo(void) {
+    return estouros_fifo;
+}
@@ -0,0 +1,26 @@
+/**
+ * adc_amostrador_modelo.c
+ *
+ * Modelo do ADC para o host: produz os códigos na ordem do rodízio e os
+ * entrega em blocos do tamanho usado pelo DMA no Pico.
+ */
+
+#include "adc_amostrador.h"
+
+#define CICLOS_POR_BLOCO 16
+
+void adc_amostrador_simular(uint32_t ciclos, adc_sinal_t sinal, void *contexto) {
+    uint8_t ordem[ADC_AMOSTRADOR_CANAIS];
+    uint8_t quantidade = adc_amostrador_rodizio(ordem);
+    uint16_t bloco[ADC_AMOSTRADOR_CANAIS * CICLOS_POR_BLOCO];
+
+    for (uint32_t ciclo = 0; ciclo < ciclos; ) {
+        uint32_t n = 0;
+        for (uint32_t k = 0; k < CICLOS_POR_BLOCO && ciclo < ciclos; k++, ciclo++) {
+            for (uint8_t i = 0; i < quantidade; i++) {
+                bloco[n++] = sinal(ordem[i], ciclo, contexto);
+            }
+        }
+        adc_amostrador_distribuir(bloco, n);
+    }
+}
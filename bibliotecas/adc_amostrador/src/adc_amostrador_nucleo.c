@@ -0,0 +1,158 @@
+/**
+ * adc_amostrador_nucleo.c
+ *
+ * Distribuição dos códigos intercalados nos anéis de cada canal, com a
+ * decimação, e a leitura pelos consumidores. Não toca no hardware: no Pico
+ * é chamado pela interrupção do DMA, no host pelo modelo do ADC.
+ */
+
+#include "adc_amostrador.h"
+#include <string.h>
+
+typedef struct {
+    volatile int32_t anel[ADC_AMOSTRADOR_ANEL];     // Códigos em Q12.F
+    volatile uint32_t escritas;     // Amostras gravadas (posição = escritas % ANEL)
+    adc_decimador_t decimador;
+} canal_t;
+
+static canal_t canais[ADC_AMOSTRADOR_CANAIS];
+static uint8_t ordem[ADC_AMOSTRADOR_CANAIS];    // Canal de cada posição do rodízio
+static uint8_t quantidade = 0;
+static uint8_t fase = 0;                        // Posição do próximo código
+
+// --------------------------------------------------------------
+// O rodízio começa no menor canal da máscara e segue em ordem
+// crescente. Zera os anéis e tira a decimação (R = 1, F = 0)
+// --------------------------------------------------------------
+bool adc_amostrador_configurar(uint8_t mascara) {
+    if (mascara == 0 || mascara >= (1u << ADC_AMOSTRADOR_CANAIS)) return false;
+
+    memset(canais, 0, sizeof(canais));
+    quantidade = 0;
+    for (uint8_t c = 0; c < ADC_AMOSTRADOR_CANAIS; c++) {
+        adc_decimador_iniciar(&canais[c].decimador, 1, 0);
+        if (mascara & ADC_MASCARA(c)) ordem[quantidade++] = c;
+    }
+    fase = 0;
+    return true;
+}
+
+// Cada amostra do canal passa a ser a saída de um CIC de 'ordem' que decima por
+// 2^log2_fator. Retorna false (e não muda nada) fora dos limites do decimador.
+// Não é seguro com a distribuição rodando (a interrupção usa o mesmo canal).
+// As amostras do anel estavam em outro Q12.F: o canal recomeça vazio e os
+// leitores dele devem ser reiniciados.
+bool adc_amostrador_decimacao(uint8_t canal, uint8_t ordem, uint8_t log2_fator) {
+    if (canal >= ADC_AMOSTRADOR_CANAIS) return false;
+    adc_decimador_t novo;
+    if (!adc_decimador_iniciar(&novo, ordem, log2_fator)) return false;
+
+    canal_t *c = &canais[canal];
+    c->decimador = novo;
+    for (uint32_t i = 0; i < ADC_AMOSTRADOR_ANEL; i++) c->anel[i] = 0;
+    c->escritas = 0;
+    return true;
+}
+
+// O próximo código recebido é do primeiro canal do rodízio.
+void adc_amostrador_ressincronizar(void) {
+    fase = 0;
+}
+
+// Canais na ordem do rodízio; retorna quantos são.
+uint8_t adc_amostrador_rodizio(uint8_t *destino) {
+    memcpy(destino, ordem, quantidade);
+    return quantidade;
+}
+
+void adc_amostrador_distribuir(const uint16_t *codigos, uint32_t total) {
+    if (quantidade == 0) return;
+
+    for (uint32_t i = 0; i < total; i++) {
+        canal_t *c = &canais[ordem[fase]];
+        if (++fase == quantidade) fase = 0;
+
+        int32_t amostra;
+        if (!adc_decimador_entrar(&c->decimador, codigos[i] & 0x0FFF, &amostra)) continue;
+
+        // Grava antes de publicar: quem lê 'escritas' já encontra a amostra
+        c->anel[c->escritas % ADC_AMOSTRADOR_ANEL] = amostra;
+        c->escritas++;
+    }
+}
+
+// Última amostra do canal em Q12.F (0 antes da primeira).
+int32_t adc_amostrador_ultimo_fino(uint8_t canal) {
+    if (canal >= ADC_AMOSTRADOR_CANAIS) return 0;
+    uint32_t escritas = canais[canal].escritas;
+    if (escritas == 0) return 0;
+    return canais[canal].anel[(escritas - 1) % ADC_AMOSTRADOR_ANEL];
+}
+
+uint8_t adc_amostrador_bits_frac(uint8_t canal) {
+    return canal < ADC_AMOSTRADOR_CANAIS ? canais[canal].decimador.bits_frac : 0;
+}
+
+// Última amostra arredondada para 12 bits.
+uint16_t adc_amostrador_ultimo(uint8_t canal) {
+    uint8_t bits = adc_amostrador_bits_frac(canal);
+    int32_t fino = adc_amostrador_ultimo_fino(canal);
+    if (bits == 0) return (uint16_t)fino;
+    return (uint16_t)((fino + (1 << (bits - 1))) >> bits);
+}
+
+uint32_t adc_amostrador_escritas(uint8_t canal) {
+    return canal < ADC_AMOSTRADOR_CANAIS ? canais[canal].escritas : 0;
+}
+
+bool adc_amostrador_tem_amostra(uint8_t canal) {
+    return adc_amostrador_escritas(canal) > 0;
+}
+
+// O leitor começa na próxima amostra: as antigas do anel não contam.
+void adc_leitor_iniciar(adc_leitor_t *leitor, uint8_t canal) {
+    leitor->canal = canal;
+    leitor->proxima = adc_amostrador_escritas(canal);
+    leitor->perdidas = 0;
+}
+
+// Quantas amostras do leitor o anel já reescreveu, com 'escritas' gravadas.
+static uint32_t atrasadas(const adc_leitor_t *leitor, uint32_t escritas) {
+    uint32_t pendentes = escritas - leitor->proxima;
+    return pendentes > ADC_AMOSTRADOR_ANEL ? pendentes - ADC_AMOSTRADOR_ANEL : 0;
+}
+
+// --------------------------------------------------------------
+// Copia até 'maximo' amostras novas, em ordem. O que o ADC
+// reescreveu antes (ou durante) a cópia é pulado e contado em
+// 'perdidas'. As amostras vêm em Q12.F. Retorna quantas foram
+// copiadas
+// --------------------------------------------------------------
+uint32_t adc_leitor_ler(adc_leitor_t *leitor, int32_t *destino, uint32_t maximo) {
+    if (leitor->canal >= ADC_AMOSTRADOR_CANAIS) return 0;
+    const canal_t *c = &canais[leitor->canal];
+
+    uint32_t escritas = c->escritas;
+    uint32_t puladas = atrasadas(leitor, escritas);
+    leitor->perdidas += puladas;
+    leitor->proxima += puladas;
+
+    uint32_t n = escritas - leitor->proxima;
+    if (n > maximo) n = maximo;
+    for (uint32_t i = 0; i < n; i++) {
+        destino[i] = c->anel[(leitor->proxima + i) % ADC_AMOSTRADOR_ANEL];
+    }
+
+    // Reescritas durante a cópia: descarta o começo do bloco
+    uint32_t invalidas = atrasadas(leitor, c->escritas);
+    if (invalidas > n) invalidas = n;
+    if (invalidas > 0) {
+        memmove(destino, destino + invalidas, (n - invalidas) * sizeof(*destino));
+        leitor->perdidas += invalidas;
+        leitor->proxima += invalidas;
+        n -= invalidas;
+    }
+
+    leitor->proxima += n;
+    return n;
+}
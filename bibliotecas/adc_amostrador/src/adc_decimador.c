@@ -0,0 +1,113 @@
+/**
+ * adc_decimador.c
+ *
+ * Integradores na taxa de entrada, pentes na taxa de saída. Na ordem 1 o
+ * bloco é somado de uma vez até a próxima saída.
+ */
+
+#include "adc_decimador.h"
+
+#define BITS_ADC 12
+#define BITS_REGISTRADOR 31     // Folga de 1 bit para o arredondamento
+
+bool adc_decimador_iniciar(adc_decimador_t *decimador, uint8_t ordem, uint8_t log2_fator) {
+    if (ordem < 1 || ordem > ADC_DECIMADOR_ORDEM_MAX) return false;
+    if (BITS_ADC + ordem * log2_fator > BITS_REGISTRADOR) return false;
+
+    decimador->ordem = ordem;
+    decimador->log2_fator = log2_fator;
+    decimador->bits_frac = log2_fator / 2;
+    adc_decimador_zerar(decimador);
+    return true;
+}
+
+// Recomeça a janela (depois de uma falha na sequência de entradas).
+void adc_decimador_zerar(adc_decimador_t *decimador) {
+    decimador->contador = 0;
+    for (int k = 0; k < ADC_DECIMADOR_ORDEM_MAX; k++) {
+        decimador->integradores[k] = 0;
+        decimador->pentes[k] = 0;
+    }
+}
+
+// --------------------------------------------------------------
+// Pentes sobre o último integrador e escala: o ganho do CIC é
+// R^ordem, e a saída mantém F bits abaixo do LSB do ADC
+// --------------------------------------------------------------
+static int32_t saida_pentes(adc_decimador_t *decimador) {
+    uint32_t v = decimador->integradores[decimador->ordem - 1];
+    for (int k = 0; k < decimador->ordem; k++) {
+        uint32_t y = v - decimador->pentes[k];
+        decimador->pentes[k] = v;
+        v = y;
+    }
+
+    uint8_t deslocamento = decimador->ordem * decimador->log2_fator - decimador->bits_frac;
+    if (deslocamento > 0) v = (v + (1u << (deslocamento - 1))) >> deslocamento;
+    return (int32_t)v;
+}
+
+bool adc_decimador_entrar(adc_decimador_t *decimador, uint16_t codigo, int32_t *saida) {
+    uint32_t v = codigo;
+    for (int k = 0; k < decimador->ordem; k++) {
+        decimador->integradores[k] += v;
+        v = decimador->integradores[k];
+    }
+
+    if (++decimador->contador < (1u << decimador->log2_fator)) return false;
+    decimador->contador = 0;
+    *saida = saida_pentes(decimador);
+    return true;
+}
+
+// --------------------------------------------------------------
+// Filtra um bloco e grava até 'maximo' saídas; retorna quantas.
+// Saídas além de 'maximo' são descartadas (o filtro segue)
+// --------------------------------------------------------------
+uint32_t adc_decimador_bloco(adc_decimador_t *decimador, const uint16_t *codigos, uint32_t quantidade,
+                             int32_t *saidas, uint32_t maximo) {
+    uint32_t geradas = 0;
+    int32_t saida;
+
+    if (decimador->ordem > 1) {
+        for (uint32_t i = 0; i < quantidade; i++) {
+            if (adc_decimador_entrar(decimador, codigos[i], &saida) && geradas < maximo) {
+                saidas[geradas++] = saida;
+            }
+        }
+        return geradas;
+    }
+
+    // Ordem 1: só somas até a fronteira da próxima saída
+    const uint32_t fator = 1u << decimador->log2_fator;
+    while (quantidade > 0) {
+        uint32_t trecho = fator - decimador->contador;
+        if (trecho > quantidade) trecho = quantidade;
+
+        uint32_t soma = 0;
+        for (uint32_t i = 0; i < trecho; i++) {
+            soma += codigos[i];
+        }
+        decimador->integradores[0] += soma;
+        decimador->contador += trecho;
+        codigos += trecho;
+        quantidade -= trecho;
+
+        if (decimador->contador == fator) {
+            decimador->contador = 0;
+            saida = saida_pentes(decimador);
+            if (geradas < maximo) saidas[geradas++] = saida;
+        }
+    }
+    return geradas;
+}
+
+// --------------------------------------------------------------
+// V (µV) = código * 3.300.000 / 2^(12 + F); cada 1,721 µV abaixo
+// de 706.000 µV é um milésimo de grau acima de 27 °C
+// --------------------------------------------------------------
+int32_t adc_temperatura_mc(int32_t codigo, uint8_t bits_frac) {
+    uint8_t escala = BITS_ADC + bits_frac;
+    int64_t microvolts = ((int64_t)codigo * 3300000 + (1ll << (escala - 1))) >> escala;
+    return (int32_t)(27000 - ((microvolts - 706000) * 1000) / 1721);
+}
@@ -0,0 +1,156 @@
+/**
+ * teste_decimador.c
+ *
+ * Ganho de resolução e custo do decimador CIC (adc_decimador.h) sobre uma
+ * entrada sintética: rampa lenta com ruído gaussiano de 1,5 LSB, quantizada
+ * em 12 bits. O ENOB de cada saída de ordem 1 é medido contra a média exata
+ * da entrada sem ruído na mesma janela e deve seguir ENOB_entrada +
+ * log2(R) / 2. Mede também o custo por entrada e por saída nas três ordens
+ * e confere que trocar a decimação de um canal descarta as amostras antigas
+ * do anel (que estavam em outro Q12.F).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "adc_amostrador.h"
+
+#define ENTRADAS (1u << 22)
+#define RUIDO_LSB 1.5
+#define FOLGA_ENOB 0.5              // Janela curta e estatística de poucas saídas
+#define REPETICOES_BANCADA 10
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static uint16_t codigos[ENTRADAS];
+static double soma_verdade[ENTRADAS + 1];     // Prefixos da entrada sem ruído
+static int32_t saidas[ENTRADAS];
+
+static double agora_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static double gaussiano(void) {
+    double u = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double v = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+static void gerar_entrada(void) {
+    srand(1);
+    soma_verdade[0] = 0;
+    for (uint32_t i = 0; i < ENTRADAS; i++) {
+        double x = 1500.3 + 0.5 * i / ENTRADAS;
+        double y = round(x + RUIDO_LSB * gaussiano());
+        codigos[i] = (uint16_t)(y < 0 ? 0 : y > 4095 ? 4095 : y);
+        soma_verdade[i + 1] = soma_verdade[i] + x;
+    }
+}
+
+// ENOB de um erro rms em LSB: o ideal de 12 bits tem 1/√12.
+static double enob(double rms_lsb) {
+    return 12.0 - log2(rms_lsb * sqrt(12.0));
+}
+
+static void testar_enob(void) {
+    double rms_entrada = 0;
+    for (uint32_t i = 0; i < ENTRADAS; i++) {
+        double e = codigos[i] - (soma_verdade[i + 1] - soma_verdade[i]);
+        rms_entrada += e * e;
+    }
+    double enob_entrada = enob(sqrt(rms_entrada / ENTRADAS));
+    printf("entrada: ENOB %.2f\n", enob_entrada);
+
+    for (uint8_t log2_fator = 2; log2_fator <= 18; log2_fator += 4) {
+        adc_decimador_t d;
+        adc_decimador_iniciar(&d, 1, log2_fator);
+        uint32_t r = 1u << log2_fator;
+        uint32_t n = adc_decimador_bloco(&d, codigos, ENTRADAS, saidas, ENTRADAS);
+
+        double soma2 = 0;
+        for (uint32_t k = 0; k < n; k++) {
+            double verdade = (soma_verdade[(k + 1) * r] - soma_verdade[k * r]) / r;
+            double e = saidas[k] / (double)(1u << d.bits_frac) - verdade;
+            soma2 += e * e;
+        }
+        double medido = enob(sqrt(soma2 / n));
+        double esperado = enob_entrada + log2_fator / 2.0;
+        printf("ordem 1, R = 2^%-2u (Q12.%u): %7u saídas, ENOB %.2f (esperado %.2f)\n",
+               log2_fator, d.bits_frac, n, medido, esperado);
+        VERIFICAR(medido >= esperado - FOLGA_ENOB, "R = 2^%u: ENOB %.2f abaixo de %.2f",
+                  log2_fator, medido, esperado - FOLGA_ENOB);
+    }
+}
+
+static void medir_custo(void) {
+    static const uint8_t fatores[] = { 0, 18, 9, 6 };    // Maior R de cada ordem
+    for (uint8_t ordem = 1; ordem <= ADC_DECIMADOR_ORDEM_MAX; ordem++) {
+        adc_decimador_t d;
+        adc_decimador_iniciar(&d, ordem, fatores[ordem]);
+        volatile uint32_t n = 0;
+
+        double t0 = agora_ns();
+        for (int r = 0; r < REPETICOES_BANCADA; r++) {
+            adc_decimador_zerar(&d);
+            n += adc_decimador_bloco(&d, codigos, ENTRADAS, saidas, ENTRADAS);
+        }
+        double ns = agora_ns() - t0;
+
+        printf("ordem %u, R = 2^%-2u: %.3f ns/entrada, %.1f ns/saída\n", ordem, fatores[ordem],
+               ns / ((double)REPETICOES_BANCADA * ENTRADAS), ns / n);
+    }
+}
+
+static uint16_t sinal_constante(uint8_t canal, uint32_t indice, void *contexto) {
+    (void)canal;
+    (void)indice;
+    return *(const uint16_t *)contexto;
+}
+
+// Amostras em Q12.0 lidas como Q12.6 davam ~430 °C logo depois da troca.
+static void testar_troca_de_decimacao(void) {
+    uint16_t codigo = 876;                      // ~27 °C no sensor interno
+    adc_amostrador_configurar(ADC_MASCARA(ADC_CANAL_TEMPERATURA));
+    adc_amostrador_simular(100, sinal_constante, &codigo);
+    VERIFICAR(adc_amostrador_ultimo_fino(ADC_CANAL_TEMPERATURA) == codigo, "sem decimação");
+
+    VERIFICAR(adc_amostrador_decimacao(ADC_CANAL_TEMPERATURA, 1, 12), "decimação recusada");
+    VERIFICAR(!adc_amostrador_tem_amostra(ADC_CANAL_TEMPERATURA),
+              "amostras do formato anterior continuam no anel");
+
+    adc_leitor_t leitor;
+    adc_leitor_iniciar(&leitor, ADC_CANAL_TEMPERATURA);
+    adc_amostrador_simular(3 << 12, sinal_constante, &codigo);
+
+    int32_t lidas[8];
+    uint32_t n = adc_leitor_ler(&leitor, lidas, 8);
+    VERIFICAR(n == 3 && leitor.perdidas == 0, "%u amostras, %u perdidas", n, leitor.perdidas);
+    for (uint32_t i = 0; i < n; i++) {
+        VERIFICAR(lidas[i] == codigo << 6, "amostra %u: %d em vez de %d", i, lidas[i], codigo << 6);
+    }
+
+    int32_t mc = adc_temperatura_mc(adc_amostrador_ultimo_fino(ADC_CANAL_TEMPERATURA),
+                                    adc_amostrador_bits_frac(ADC_CANAL_TEMPERATURA));
+    VERIFICAR(mc > 25000 && mc < 29000, "%d m°C depois da troca", mc);
+}
+
+int main(void) {
+    gerar_entrada();
+    testar_enob();
+    medir_custo();
+    testar_troca_de_decimacao();
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
@@ -0,0 +1,20 @@
+#ifndef MATRIZ_LED_H
+#define MATRIZ_LED_H
+
+#include <stdint.h>
+
+// Um LED WS2812 na ordem em que os bytes saem no fio.
+typedef struct {
+    uint8_t G, R, B;
+} npLED_t;
+
+// Geometria de uma matriz de LEDs ligada como fita: quem tem o hardware (o driver)
+// preenche os índices; quem desenha (o motor de efeitos) só consulta.
+typedef struct {
+    uint16_t colunas;
+    uint16_t linhas;
+    const uint16_t *mapa;       // [y * colunas + x] -> índice na fita, y = 0 no topo
+    const uint16_t *espiral;    // colunas * linhas índices, da borda para o centro
+} matriz_led_t;
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef MOTOR_EFEITOS_H
+#define MOTOR_EFEITOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matriz_led.h"
+
+// Quantidade máxima de efeitos compostos no mesmo quadro.
+#define MOTOR_MAX_EFEITOS 4
+
+typedef enum {
+    EFEITO_ESPIRAL,
+    EFEITO_ESPIRAL_INVERSA,
+    EFEITO_ONDA_VERTICAL,
+    EFEITO_ONDA_VERTICAL_BRILHO,
+    EFEITO_FILEIRAS,
+    EFEITO_FILEIRAS_REVERSO,
+    EFEITO_COLUNAS,
+    EFEITO_COLUNAS_REVERSO,
+} efeito_tipo_t;
+
+// Estado de um efeito: o quadro desenhado depende só de 'passo', então o efeito
+// pode ser pausado, retomado ou composto com outros sem sleep_ms().
+typedef struct {
+    const matriz_led_t *matriz;
+    efeito_tipo_t tipo;
+    uint8_t r, g, b;
+    uint32_t periodo_us;    // Intervalo entre passos (o antigo delay_ms)
+    uint64_t proximo_us;    // Instante do próximo avanço
+    uint16_t passo;
+    uint16_t total_passos;
+    bool repetir;           // Volta ao passo 0 em vez de concluir
+    bool ativo;             // false quando concluído (fica parado no último passo)
+} effect_t;
+
+// Escalonador: compõe os efeitos registrados a uma taxa de quadros fixa.
+// O tempo é sempre recebido por parâmetro, então roda com relógio real ou virtual.
+typedef struct {
+    const matriz_led_t *matriz;
+    effect_t *efeitos[MOTOR_MAX_EFEITOS];
+    uint32_t periodo_quadro_us;
+    uint64_t proximo_quadro_us;
+    bool sujo;              // Efeito adicionado/removido: recompor mesmo sem avanço
+} effect_scheduler_t;
+
+void effect_start(effect_t *e, const matriz_led_t *m, efeito_tipo_t tipo, uint8_t r, uint8_t g, uint8_t b,
+                  uint16_t delay_ms, bool repetir, uint64_t now_us);
+bool effect_step(effect_t *e, uint64_t now_us);
+void effect_render(const effect_t *e, npLED_t *quadro);
+
+void scheduler_init(effect_scheduler_t *s, const matriz_led_t *m, uint16_t fps, uint64_t now_us);
+bool scheduler_add(effect_scheduler_t *s, effect_t *e);
+void scheduler_remove(effect_scheduler_t *s, effect_t *e);
+bool scheduler_idle(const effect_scheduler_t *s);
+bool scheduler_tick(effect_scheduler_t *s, uint64_t now_us, npLED_t *quadro);
+
+#endif
@@ -0,0 +1,186 @@
+#include <string.h>
+#include <stdlib.h>
+#include "motor_efeitos.h"
+
+static uint16_t total_passos(efeito_tipo_t tipo, const matriz_led_t *m) {
+    switch (tipo) {
+        case EFEITO_ESPIRAL:
+        case EFEITO_ESPIRAL_INVERSA:      return m->colunas * m->linhas;
+        case EFEITO_ONDA_VERTICAL:        return m->linhas + 3;
+        case EFEITO_COLUNAS:
+        case EFEITO_COLUNAS_REVERSO:      return m->colunas;
+        default:                          return m->linhas;
+    }
+}
+
+// Soma a cor ao LED com saturação, para que efeitos sobrepostos se misturem.
+static void somar_led(npLED_t *quadro, unsigned index, unsigned r, unsigned g, unsigned b) {
+    npLED_t *led = &quadro[index];
+    unsigned nr = led->R + r, ng = led->G + g, nb = led->B + b;
+    led->R = nr > 255 ? 255 : nr;
+    led->G = ng > 255 ? 255 : ng;
+    led->B = nb > 255 ? 255 : nb;
+}
+
+static void somar_fileira(const effect_t *e, npLED_t *quadro, unsigned y, unsigned num, unsigned den) {
+    const matriz_led_t *m = e->matriz;
+    const uint16_t *linha = &m->mapa[y * m->colunas];
+    for (unsigned x = 0; x < m->colunas; ++x) {
+        somar_led(quadro, linha[x], e->r * num / den, e->g * num / den, e->b * num / den);
+    }
+}
+
+static void somar_coluna(const effect_t *e, npLED_t *quadro, unsigned x, unsigned num, unsigned den) {
+    const matriz_led_t *m = e->matriz;
+    for (unsigned y = 0; y < m->linhas; ++y) {
+        somar_led(quadro, m->mapa[y * m->colunas + x], e->r * num / den, e->g * num / den, e->b * num / den);
+    }
+}
+
+void effect_start(effect_t *e, const matriz_led_t *m, efeito_tipo_t tipo, uint8_t r, uint8_t g, uint8_t b,
+                  uint16_t delay_ms, bool repetir, uint64_t now_us) {
+    e->matriz = m;
+    e->tipo = tipo;
+    e->r = r;
+    e->g = g;
+    e->b = b;
+    e->periodo_us = (uint32_t)delay_ms * 1000u;
+    e->proximo_us = now_us + e->periodo_us;
+    e->passo = 0;
+    e->total_passos = total_passos(tipo, m);
+    e->repetir = repetir;
+    e->ativo = true;
+}
+
+// Avança o efeito se o instante do próximo passo já chegou. Retorna true se o quadro mudou.
+// O último passo continua visível por um período inteiro antes de o efeito concluir.
+bool effect_step(effect_t *e, uint64_t now_us) {
+    if (!e->ativo || now_us < e->proximo_us) return false;
+
+    e->proximo_us += e->periodo_us;
+    if (e->proximo_us <= now_us) e->proximo_us = now_us + e->periodo_us;  // Atrasou: ressincroniza
+
+    if (e->passo + 1 < e->total_passos) {
+        e->passo++;
+    } else if (e->repetir) {
+        e->passo = 0;
+    } else {
+        e->ativo = false;
+        return false;
+    }
+    return true;
+}
+
+// Desenha (somando) o passo atual do efeito no quadro.
+void effect_render(const effect_t *e, npLED_t *quadro) {
+    const matriz_led_t *m = e->matriz;
+    unsigned total = m->colunas * m->linhas;
+
+    switch (e->tipo) {
+        case EFEITO_ESPIRAL:
+            for (unsigned i = 0; i <= e->passo; ++i) {
+                somar_led(quadro, m->espiral[i], e->r, e->g, e->b);
+            }
+            break;
+        case EFEITO_ESPIRAL_INVERSA:
+            for (unsigned i = 0; i <= e->passo; ++i) {
+                somar_led(quadro, m->espiral[total - 1 - i], e->r, e->g, e->b);
+            }
+            break;
+        case EFEITO_ONDA_VERTICAL:
+            // Intensidade em quartos: 4/4 na linha da fase, 1/4 a menos por linha de distância
+            for (int y = 0; y < m->linhas; ++y) {
+                int intensidade = 4 - abs((int)e->passo - y);
+                if (intensidade > 0) somar_fileira(e, quadro, y, intensidade, 4);
+            }
+            break;
+        case EFEITO_ONDA_VERTICAL_BRILHO:
+            for (unsigned y = 0; y <= e->passo; ++y) {
+                somar_fileira(e, quadro, y, y + 1, m->linhas);
+            }
+            break;
+        case EFEITO_FILEIRAS:
+            somar_fileira(e, quadro, e->passo, e->passo + 1, m->linhas);
+            break;
+        case EFEITO_FILEIRAS_REVERSO:
+            somar_fileira(e, quadro, m->linhas - 1 - e->passo, e->passo + 1, m->linhas);
+            break;
+        case EFEITO_COLUNAS:
+            somar_coluna(e, quadro, e->passo, e->passo + 1, m->colunas);
+            break;
+        case EFEITO_COLUNAS_REVERSO:
+            somar_coluna(e, quadro, m->colunas - 1 - e->passo, e->passo + 1, m->colunas);
+            break;
+    }
+}
+
+void scheduler_init(effect_scheduler_t *s, const matriz_led_t *m, uint16_t fps, uint64_t now_us) {
+    memset(s->efeitos, 0, sizeof(s->efeitos));
+    s->matriz = m;
+    s->periodo_quadro_us = 1000000u / fps;
+    s->proximo_quadro_us = now_us;
+    s->sujo = false;
+}
+
+bool scheduler_add(effect_scheduler_t *s, effect_t *e) {
+    for (unsigned i = 0; i < MOTOR_MAX_EFEITOS; ++i) {
+        if (s->efeitos[i] == NULL) {
+            s->efeitos[i] = e;
+            s->sujo = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+void scheduler_remove(effect_scheduler_t *s, effect_t *e) {
+    for (unsigned i = 0; i < MOTOR_MAX_EFEITOS; ++i) {
+        if (s->efeitos[i] == e) {
+            s->efeitos[i] = NULL;
+            s->sujo = true;
+        }
+    }
+}
+
+// Verdadeiro quando nenhum efeito registrado ainda está animando.
+bool scheduler_idle(const effect_scheduler_t *s) {
+    for (unsigned i = 0; i < MOTOR_MAX_EFEITOS; ++i) {
+        if (s->efeitos[i] && s->efeitos[i]->ativo) return false;
+    }
+    return true;
+}
+
+static bool scheduler_vazio(const effect_scheduler_t *s) {
+    for (unsigned i = 0; i < MOTOR_MAX_EFEITOS; ++i) {
+        if (s->efeitos[i]) return false;
+    }
+    return true;
+}
+
+// Se chegou a hora do próximo quadro, avança todos os efeitos e compõe o quadro.
+// Retorna true quando 'quadro' foi redesenhado (algum efeito mudou) e deve ser enviado.
+// Sem efeitos registrados o motor não compõe nada: o que foi desenhado por fora
+// (ex.: o número do sorteio) não é apagado por um quadro vazio.
+bool scheduler_tick(effect_scheduler_t *s, uint64_t now_us, npLED_t *quadro) {
+    if (scheduler_vazio(s)) {
+        s->sujo = false;
+        return false;
+    }
+    if (now_us < s->proximo_quadro_us) return false;
+
+    s->proximo_quadro_us += s->periodo_quadro_us;
+    if (s->proximo_quadro_us <= now_us) s->proximo_quadro_us = now_us + s->periodo_quadro_us;
+
+    bool mudou = s->sujo;
+    for (unsigned i = 0; i < MOTOR_MAX_EFEITOS; ++i) {
+        if (s->efeitos[i]) mudou |= effect_step(s->efeitos[i], now_us);
+    }
+    if (!mudou) return false;
+    s->sujo = false;
+
+    memset(quadro, 0, sizeof(npLED_t) * s->matriz->colunas * s->matriz->linhas);
+    for (unsigned i = 0; i < MOTOR_MAX_EFEITOS; ++i) {
+        if (s->efeitos[i]) effect_render(s->efeitos[i], quadro);
+    }
+    return true;
+}
@@ -0,0 +1,204 @@
+/**
+ * teste_motor.c
+ *
+ * Motor de efeitos com relógio virtual, numa matriz 5x5 ligada como a da
+ * BitDogLab (LED 0 embaixo à direita, serpentina):
+ *  - effect_step só avança no instante do passo, ressincroniza quando atrasa,
+ *    mostra o último passo por um período inteiro e repete quando pedido;
+ *  - effect_render desenha pela geometria recebida (espiral, fileiras,
+ *    colunas, onda) e satura a soma de efeitos sobrepostos;
+ *  - scheduler_tick compõe na taxa de quadros, só quando algo mudou, e não
+ *    toca no quadro sem efeitos registrados.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "motor_efeitos.h"
+
+#define COLUNAS 5
+#define LINHAS 5
+#define TOTAL (COLUNAS * LINHAS)
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static uint16_t mapa[TOTAL];
+static uint16_t espiral[TOTAL];
+static const matriz_led_t matriz = { COLUNAS, LINHAS, mapa, espiral };
+
+// Espiral da borda para o centro, em coordenadas lógicas (x, y), escrita à mão.
+static const uint8_t espiral_xy[TOTAL][2] = {
+    {0,0},{1,0},{2,0},{3,0},{4,0}, {4,1},{4,2},{4,3},{4,4}, {3,4},{2,4},{1,4},{0,4},
+    {0,3},{0,2},{0,1}, {1,1},{2,1},{3,1}, {3,2},{3,3}, {2,3},{1,3}, {1,2}, {2,2},
+};
+
+static void montar_matriz(void) {
+    for (unsigned y = 0; y < LINHAS; ++y) {
+        unsigned linha_fisica = LINHAS - 1 - y;
+        for (unsigned x = 0; x < COLUNAS; ++x) {
+            mapa[y * COLUNAS + x] = linha_fisica * COLUNAS +
+                                    (linha_fisica % 2 == 0 ? COLUNAS - 1 - x : x);
+        }
+    }
+    for (unsigned i = 0; i < TOTAL; ++i) {
+        espiral[i] = mapa[espiral_xy[i][1] * COLUNAS + espiral_xy[i][0]];
+    }
+}
+
+static npLED_t pixel(const npLED_t *quadro, unsigned x, unsigned y) {
+    return quadro[mapa[y * COLUNAS + x]];
+}
+
+static bool igual(npLED_t a, uint8_t r, uint8_t g, uint8_t b) {
+    return a.R == r && a.G == g && a.B == b;
+}
+
+static void teste_passos(void) {
+    effect_t e;
+    effect_start(&e, &matriz, EFEITO_ESPIRAL, 10, 20, 30, 10, false, 1000);
+    VERIFICAR(e.total_passos == TOTAL && e.passo == 0 && e.ativo, "início do efeito");
+
+    VERIFICAR(!effect_step(&e, 10999) && e.passo == 0, "avançou antes do período");
+    VERIFICAR(effect_step(&e, 11000) && e.passo == 1, "não avançou no instante do passo");
+    VERIFICAR(e.proximo_us == 21000, "próximo passo em %llu, esperado 21000", (unsigned long long)e.proximo_us);
+
+    // Atraso de vários períodos: um passo só, e o próximo conta a partir de agora.
+    VERIFICAR(effect_step(&e, 50000) && e.passo == 2, "atrasado: não avançou um passo");
+    VERIFICAR(e.proximo_us == 60000, "atrasado: próximo em %llu, esperado 60000", (unsigned long long)e.proximo_us);
+
+    uint64_t t = 60000;
+    while (e.passo < TOTAL - 1) {
+        VERIFICAR(effect_step(&e, t), "passo %u não avançou", e.passo);
+        t += 10000;
+    }
+    VERIFICAR(e.ativo, "concluiu ao chegar ao último passo");
+    VERIFICAR(!effect_step(&e, t - 1) && e.ativo, "último passo não ficou um período inteiro");
+    VERIFICAR(!effect_step(&e, t) && !e.ativo && e.passo == TOTAL - 1, "não concluiu depois do último passo");
+    VERIFICAR(!effect_step(&e, t + 1000000), "efeito concluído voltou a avançar");
+
+    effect_start(&e, &matriz, EFEITO_FILEIRAS, 1, 1, 1, 1, true, 0);
+    for (unsigned i = 1; i <= LINHAS; ++i) effect_step(&e, i * 1000);
+    VERIFICAR(e.ativo && e.passo == 0, "repetir: passo %u depois de %u avanços", e.passo, LINHAS);
+}
+
+static void teste_desenho(void) {
+    npLED_t quadro[TOTAL];
+    effect_t e;
+
+    // Espiral no passo 2: os três primeiros LEDs da borda superior.
+    effect_start(&e, &matriz, EFEITO_ESPIRAL, 10, 20, 30, 10, false, 0);
+    e.passo = 2;
+    memset(quadro, 0, sizeof(quadro));
+    effect_render(&e, quadro);
+    for (unsigned y = 0; y < LINHAS; ++y) {
+        for (unsigned x = 0; x < COLUNAS; ++x) {
+            bool aceso = y == 0 && x <= 2;
+            VERIFICAR(igual(pixel(quadro, x, y), aceso ? 10 : 0, aceso ? 20 : 0, aceso ? 30 : 0),
+                      "espiral passo 2: (%u, %u) errado", x, y);
+        }
+    }
+
+    // Espiral inversa no passo 0: só o centro.
+    effect_start(&e, &matriz, EFEITO_ESPIRAL_INVERSA, 10, 20, 30, 10, false, 0);
+    memset(quadro, 0, sizeof(quadro));
+    effect_render(&e, quadro);
+    VERIFICAR(igual(pixel(quadro, 2, 2), 10, 20, 30) && igual(pixel(quadro, 0, 0), 0, 0, 0),
+              "espiral inversa não começa no centro");
+
+    // Coluna reversa no passo 1: x = 3 com 2/5 da cor.
+    effect_start(&e, &matriz, EFEITO_COLUNAS_REVERSO, 100, 50, 250, 10, false, 0);
+    e.passo = 1;
+    memset(quadro, 0, sizeof(quadro));
+    effect_render(&e, quadro);
+    for (unsigned y = 0; y < LINHAS; ++y) {
+        VERIFICAR(igual(pixel(quadro, 3, y), 40, 20, 100), "coluna reversa: (3, %u) errado", y);
+        VERIFICAR(igual(pixel(quadro, 1, y), 0, 0, 0), "coluna reversa: (1, %u) aceso", y);
+    }
+
+    // Onda no passo 1: linha 1 inteira, 3/4 nas vizinhas, 2/4 na linha 3, 1/4 na 4.
+    effect_start(&e, &matriz, EFEITO_ONDA_VERTICAL, 200, 0, 0, 10, false, 0);
+    e.passo = 1;
+    memset(quadro, 0, sizeof(quadro));
+    effect_render(&e, quadro);
+    static const uint8_t onda[LINHAS] = { 150, 200, 150, 100, 50 };
+    for (unsigned y = 0; y < LINHAS; ++y) {
+        for (unsigned x = 0; x < COLUNAS; ++x) {
+            VERIFICAR(pixel(quadro, x, y).R == onda[y], "onda: (%u, %u) = %u, esperado %u",
+                      x, y, pixel(quadro, x, y).R, onda[y]);
+        }
+    }
+
+    // Dois efeitos no mesmo LED: a soma satura em 255.
+    effect_t a, b;
+    effect_start(&a, &matriz, EFEITO_FILEIRAS, 200, 200, 10, 10, false, 0);
+    effect_start(&b, &matriz, EFEITO_COLUNAS, 100, 10, 10, 10, false, 0);
+    a.passo = LINHAS - 1;       // Fileira y = 4 com a cor inteira
+    b.passo = COLUNAS - 1;      // Coluna x = 4 com a cor inteira
+    memset(quadro, 0, sizeof(quadro));
+    effect_render(&a, quadro);
+    effect_render(&b, quadro);
+    VERIFICAR(igual(pixel(quadro, 4, 4), 255, 210, 20), "sobreposição não saturou");
+}
+
+static void teste_escalonador(void) {
+    npLED_t quadro[TOTAL];
+    effect_scheduler_t s;
+    effect_t e;
+
+    // Sem efeitos: nada é composto e o quadro de fora continua intacto.
+    scheduler_init(&s, &matriz, 50, 0);
+    memset(quadro, 0x5a, sizeof(quadro));
+    VERIFICAR(!scheduler_tick(&s, 0, quadro) && quadro[7].G == 0x5a, "motor vazio mexeu no quadro");
+    VERIFICAR(scheduler_idle(&s), "motor vazio não está ocioso");
+
+    // Espiral repetida de 40 ms a 50 fps, 1 s de relógio virtual em passos de 1 ms:
+    // o quadro inicial (efeito novo) mais um por passo do efeito.
+    effect_start(&e, &matriz, EFEITO_ESPIRAL, 0, 64, 64, 40, true, 0);
+    VERIFICAR(scheduler_add(&s, &e), "scheduler_add falhou");
+    unsigned quadros = 0;
+    for (uint64_t t = 0; t <= 1000000; t += 1000) {
+        bool desenhou = scheduler_tick(&s, t, quadro);
+        VERIFICAR(!desenhou || t % 20000 == 0, "quadro fora da taxa em %llu us", (unsigned long long)t);
+        quadros += desenhou;
+    }
+    VERIFICAR(quadros == 1 + 25, "%u quadros compostos em 1 s, esperado 26", quadros);
+    VERIFICAR(quadro[espiral[e.passo]].G == 64 && (e.passo == TOTAL - 1 || quadro[espiral[e.passo + 1]].G == 0),
+              "quadro não corresponde ao passo %u", e.passo);
+    VERIFICAR(!scheduler_idle(&s), "efeito repetido ficou ocioso");
+
+    // Efeito que termina: o motor fica ocioso e para de compor.
+    effect_t fim;
+    effect_start(&fim, &matriz, EFEITO_FILEIRAS, 30, 0, 0, 20, false, 1020000);
+    scheduler_remove(&s, &e);
+    scheduler_add(&s, &fim);
+    uint64_t t = 1020000;
+    VERIFICAR(scheduler_tick(&s, t, quadro), "troca de efeito não recompôs");
+    VERIFICAR(pixel(quadro, 0, 0).R == 30 / LINHAS && quadro[espiral[0]].G == 0,
+              "troca de efeito deixou restos do anterior");
+    for (; t <= 1200000; t += 20000) scheduler_tick(&s, t, quadro);
+    VERIFICAR(scheduler_idle(&s) && !fim.ativo, "efeito sem repetição não terminou");
+    VERIFICAR(!scheduler_tick(&s, t + 20000, quadro), "motor ocioso recompôs o quadro");
+
+    // Mais efeitos que o limite.
+    effect_t extra[MOTOR_MAX_EFEITOS];
+    unsigned aceitos = 0;
+    for (unsigned i = 0; i < MOTOR_MAX_EFEITOS; ++i) aceitos += scheduler_add(&s, &extra[i]);
+    VERIFICAR(aceitos == MOTOR_MAX_EFEITOS - 1, "aceitou %u efeitos com um já registrado", aceitos);
+}
+
+int main(void) {
+    montar_matriz();
+    teste_passos();
+    teste_desenho();
+    teste_escalonador();
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
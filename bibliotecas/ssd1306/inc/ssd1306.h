@@ -0,0 +1,15 @@
+#ifndef SSD1306_H
+#define SSD1306_H
+
+// Driver SSD1306 completo (API global e instâncias), para quem inclui um único cabeçalho.
+#include "ssd1306_i2c.h"
+#include "ssd1306_init.h"
+#include "ssd1306_utils.h"
+#include "ssd1306_text.h"
+#include "ssd1306_graphics.h"
+#include "ssd1306_bitmap.h"
+#include "ssd1306_grande.h"
+#include "ssd1306_cena.h"
+#include "ssd1306_rolagem.h"
+
+#endif // SSD1306_H
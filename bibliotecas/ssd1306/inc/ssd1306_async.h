@@ -0,0 +1,47 @@
+#ifndef SSD1306_ASYNC_H
+#define SSD1306_ASYNC_H
+
+#include "hardware/i2c.h"
+#include "ssd1306_dev.h"
+
+// Transporte assíncrono: as transações do display são montadas num lote de palavras
+// IC_DATA_CMD (byte + bits de STOP/RESTART) que um canal DMA entrega ao FIFO de TX do I2C.
+// O quadro fica livre assim que o lote é montado. Há um lote só: com vários displays,
+// os envios se revezam (ssd1306_async_iniciar_lote() espera o DMA anterior).
+
+// Pior caso de um lote: todas as páginas, cada uma com uma sessão de janela
+// (controle 0x00 + 6 comandos) e dados (controle 0x40 + largura).
+#define SSD1306_ASYNC_MAX_PALAVRAS (SSD1306_PAGINAS_MAX * (1 + 6 + 1 + SSD1306_LARGURA_MAX))
+
+// Chamada no handler do DMA (contexto de interrupção) quando o lote inteiro foi
+// entregue ao I2C. Os últimos bytes ainda saem do FIFO; use ssd1306_async_ocupado().
+typedef void (*ssd1306_async_callback_t)(void *contexto);
+
+// Resultado das esperas. Em ABORTADO (NAK, display ausente, perda de arbitragem) e em
+// TEMPO_ESGOTADO o lote em curso é descartado, o DMA é cancelado e o callback dele não
+// é chamado; o próximo lote começa com o barramento limpo.
+typedef enum {
+    SSD1306_ASYNC_OK = 0,
+    SSD1306_ASYNC_ABORTADO,
+    SSD1306_ASYNC_TEMPO_ESGOTADO,
+} ssd1306_async_erro_t;
+
+// Prazo de um lote: 9 bits por palavra no modo padrão (100 kHz), o mais lento que o
+// display aceita, mais uma folga para o início da transferência.
+#define SSD1306_ASYNC_US_POR_PALAVRA 90
+#define SSD1306_ASYNC_FOLGA_US 1000
+
+bool ssd1306_async_init(void);
+bool ssd1306_async_ocupado(void);
+ssd1306_async_erro_t ssd1306_async_aguardar(void);
+uint32_t ssd1306_async_fonte_abort(void);
+
+ssd1306_async_erro_t ssd1306_async_iniciar_lote(void);
+bool ssd1306_async_comandos(const uint8_t *comandos, int quantidade);
+bool ssd1306_async_dados(const uint8_t *dados, int tamanho);
+bool ssd1306_async_janela(const uint8_t *comandos, int quantidade, const uint8_t *dados, int tamanho);
+bool ssd1306_async_enviar(ssd1306_dev_t *dev, ssd1306_async_callback_t callback, void *contexto);
+
+bool ssd1306_dev_flush_async(ssd1306_dev_t *dev, ssd1306_async_callback_t callback, void *contexto);
+
+#endif // SSD1306_ASYNC_H
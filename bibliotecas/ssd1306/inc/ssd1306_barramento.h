@@ -0,0 +1,19 @@
+#ifndef SSD1306_BARRAMENTO_H
+#define SSD1306_BARRAMENTO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Transporte de uma instância do display. 'escrever' faz uma transação
+// (START, endereço, bytes); com 'sem_stop' ela não termina e a escrita seguinte
+// começa com RESTART, como o 'nostop' de i2c_write_blocking().
+typedef void (*ssd1306_escrever_t)(void *porta, uint8_t endereco, const uint8_t *bytes,
+                                   size_t tamanho, bool sem_stop);
+
+typedef struct {
+    ssd1306_escrever_t escrever;
+    void *porta;    // i2c_inst_t * no Pico; ssd1306_falso_t * no host
+} ssd1306_barramento_t;
+
+#endif // SSD1306_BARRAMENTO_H
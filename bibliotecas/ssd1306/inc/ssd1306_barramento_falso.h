@@ -0,0 +1,21 @@
+#ifndef SSD1306_BARRAMENTO_FALSO_H
+#define SSD1306_BARRAMENTO_FALSO_H
+
+#include "ssd1306_barramento.h"
+
+// Barramento falso para a biblioteca de host: guarda os bytes escritos (sem o
+// endereço) e conta bytes e transações, sem nenhum hardware.
+#define SSD1306_FALSO_REGISTRO 2048
+
+typedef struct {
+    uint8_t registro[SSD1306_FALSO_REGISTRO];
+    size_t tamanho;         // Bytes guardados em 'registro' (o excesso é descartado)
+    uint32_t bytes;         // Total escrito, incluindo os descartados
+    uint32_t transacoes;    // Sessões START..STOP concluídas
+    uint8_t endereco;       // Alvo da última escrita
+} ssd1306_falso_t;
+
+void ssd1306_falso_limpar(ssd1306_falso_t *falso);
+ssd1306_barramento_t ssd1306_barramento_falso(ssd1306_falso_t *falso);
+
+#endif // SSD1306_BARRAMENTO_FALSO_H
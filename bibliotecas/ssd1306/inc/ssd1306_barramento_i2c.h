@@ -0,0 +1,12 @@
+#ifndef SSD1306_BARRAMENTO_I2C_H
+#define SSD1306_BARRAMENTO_I2C_H
+
+#include "hardware/i2c.h"
+#include "ssd1306_barramento.h"
+
+// Barramento real: i2c_write_blocking() na porta dada, esperando antes um lote
+// DMA de ssd1306_async que ainda esteja no barramento.
+ssd1306_barramento_t ssd1306_barramento_i2c(i2c_inst_t *i2c);
+bool ssd1306_barramento_e_i2c(const ssd1306_barramento_t *barramento);
+
+#endif // SSD1306_BARRAMENTO_I2C_H
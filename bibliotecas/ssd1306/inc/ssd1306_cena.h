@@ -0,0 +1,71 @@
+#ifndef SSD1306_CENA_H
+#define SSD1306_CENA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306_dev.h"
+
+// Cena retida: a tela é descrita uma vez como elementos (textos, valores,
+// barras, alertas que piscam), cada um com a sua caixa. Alterar um elemento
+// só o marca; ssd1306_cena_atualizar() apaga e redesenha a caixa dos que
+// mudaram e envia só essas regiões. Nenhuma função daqui espera tempo passar:
+// piscar e textos temporários têm prazos, vencidos a cada atualização.
+
+#define SSD1306_CENA_MAX_ELEMENTOS 12
+#define SSD1306_ELEMENTO_TEXTO_MAX 48       // Bytes UTF-8, com o terminador
+#define SSD1306_CENA_SEM_PRAZO UINT32_MAX
+
+typedef enum {
+    SSD1306_ELEMENTO_TEXTO = 0,     // Rótulo ou valor: texto 8x8 quebrado em '\n' e na largura da caixa
+    SSD1306_ELEMENTO_BARRA,         // Barra de progresso com contorno, de 0 a 100 %
+} ssd1306_elemento_tipo_t;
+
+typedef struct {
+    ssd1306_elemento_tipo_t tipo;
+    int16_t x, y;                   // Canto superior esquerdo da caixa
+    uint8_t largura, altura;        // Caixa apagada a cada redesenho
+    bool centralizar;               // Centraliza cada linha do texto na caixa
+    volatile bool sujo;             // Pode ser marcado de uma interrupção
+    char texto[SSD1306_ELEMENTO_TEXTO_MAX];
+    uint8_t porcento;
+
+    // Piscar: alterna entre visível e apagado a cada 'intervalo_ms'
+    bool piscando;
+    bool visivel;
+    uint32_t intervalo_ms;
+    uint32_t proxima_troca_ms;
+
+    // Texto temporário: apagado quando 'expira_ms' chega
+    bool temporario;
+    uint32_t expira_ms;
+} ssd1306_elemento_t;
+
+typedef struct {
+    ssd1306_dev_t *dev;
+    ssd1306_elemento_t elementos[SSD1306_CENA_MAX_ELEMENTOS];
+    uint8_t quantidade;
+    volatile bool pendente;         // Um prazo venceu (marcado pelo alarme)
+    volatile int32_t alarme;        // Alarme armado por ssd1306_cena_processar() (0 = nenhum)
+} ssd1306_cena_t;
+
+void ssd1306_cena_iniciar(ssd1306_cena_t *cena, ssd1306_dev_t *dev);
+ssd1306_elemento_t *ssd1306_cena_texto(ssd1306_cena_t *cena, int16_t x, int16_t y,
+                                       uint8_t largura, uint8_t altura, const char *texto);
+ssd1306_elemento_t *ssd1306_cena_barra(ssd1306_cena_t *cena, int16_t x, int16_t y,
+                                       uint8_t largura, uint8_t altura);
+void ssd1306_cena_redesenhar(ssd1306_cena_t *cena);
+bool ssd1306_cena_tem_sujo(const ssd1306_cena_t *cena);
+uint32_t ssd1306_cena_atualizar(ssd1306_cena_t *cena, uint32_t agora_ms);
+
+// Só com o Pico SDK: atualiza se algo mudou ou se um prazo venceu e arma um
+// alarme para o próximo prazo. Para chamar no laço principal, sem esperas.
+void ssd1306_cena_processar(ssd1306_cena_t *cena);
+
+void ssd1306_elemento_texto(ssd1306_elemento_t *elemento, const char *texto);
+void ssd1306_elemento_temporario(ssd1306_elemento_t *elemento, const char *texto,
+                                 uint32_t duracao_ms, uint32_t agora_ms);
+void ssd1306_elemento_porcento(ssd1306_elemento_t *elemento, uint8_t porcento);
+void ssd1306_elemento_piscar(ssd1306_elemento_t *elemento, bool piscar,
+                             uint32_t intervalo_ms, uint32_t agora_ms);
+
+#endif // SSD1306_CENA_H
@@ -1,16 +1,10 @@
-#include <stdlib.h>
-#include "pico/stdlib.h"
-#include "hardware/i2c.h"
+#ifndef SSD1306_COMANDOS_H
+#define SSD1306_COMANDOS_H
 
-#ifndef ssd1306_inc_h
-#define ssd1306_inc_h
-
-#define ssd1306_height 64 // Define a altura do display (32 pixels)
-#define ssd1306_width 128 // Define a largura do display (128 pixels)
-
-#define ssd1306_i2c_address _u(0x3C) // Define o endereço do i2c do display
-
-#define ssd1306_i2c_clock 400 // Define o tempo do clock (pode ser aumentado)
+// Fora do Pico SDK (biblioteca de host) não existe o _u() de pico/platform.h.
+#ifndef _u
+#define _u(x) x ## u
+#endif
 
 // Comandos de configuração (endereços)
 #define ssd1306_set_memory_mode _u(0x20)
@@ -41,28 +35,8 @@
 #define ssd1306_set_vcomh_deselect_level _u(0xDB)
 
 #define ssd1306_page_height _u(8)
-#define ssd1306_n_pages (ssd1306_height / ssd1306_page_height)
-#define ssd1306_buffer_length (ssd1306_n_pages * ssd1306_width)
 
 #define ssd1306_write_mode _u(0xFE)
 #define ssd1306_read_mode _u(0xFF)
 
-struct render_area {
-    uint8_t start_column;
-    uint8_t end_column;
-    uint8_t start_page;
-    uint8_t end_page;
-
-    int buffer_length;
-};
-
-typedef struct {
-  uint8_t width, height, pages, address;
-  i2c_inst_t * i2c_port;
-  bool external_vcc;
-  uint8_t *ram_buffer;
-  size_t bufsize;
-  uint8_t port_buffer[2];
-} ssd1306_t;
-
-#endif
\ No newline at end of file
+#endif // SSD1306_COMANDOS_H
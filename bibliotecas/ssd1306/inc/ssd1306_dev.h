@@ -0,0 +1,87 @@
+#ifndef SSD1306_DEV_H
+#define SSD1306_DEV_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306_comandos.h"
+#include "ssd1306_barramento.h"
+
+// Maior painel que o controlador endereça (RAM de 128 x 64).
+#define SSD1306_LARGURA_MAX 128
+#define SSD1306_ALTURA_MAX 64
+#define SSD1306_PAGINAS_MAX (SSD1306_ALTURA_MAX / 8)
+
+// Bytes do quadro de uma instância: o controle 0x40 reservado e uma página de
+// 'largura' bytes a cada 8 linhas. O quadro vai para o barramento sem cópia.
+#define SSD1306_QUADRO_TAMANHO(largura, altura) (1 + (largura) * ((altura) / 8))
+
+// O controlador só espelha segmentos e a varredura de COM: 0 e 180 graus.
+typedef enum {
+    SSD1306_ROTACAO_0 = 0,
+    SSD1306_ROTACAO_180,
+} ssd1306_rotacao_t;
+
+typedef struct {
+    ssd1306_barramento_t barramento;
+    uint8_t endereco;
+    uint8_t largura;            // Até SSD1306_LARGURA_MAX
+    uint8_t altura;             // 16 a 64, múltiplo de 8
+    ssd1306_rotacao_t rotacao;
+    bool vcc_externo;
+} ssd1306_config_t;
+
+// Uma instância por display. Vários displays podem dividir um barramento (com
+// endereços diferentes) ou usar barramentos separados; cada um tem seu quadro,
+// suas regiões sujas e seus contadores.
+typedef struct {
+    ssd1306_config_t cfg;
+    uint8_t paginas;
+    uint8_t *pixels;                        // pixels[-1] é o controle reservado
+    uint8_t sujo_x0[SSD1306_PAGINAS_MAX];   // Página limpa: sujo_x0 > sujo_x1
+    uint8_t sujo_x1[SSD1306_PAGINAS_MAX];
+    uint32_t bytes_enviados;                // Bytes escritos no barramento
+    uint32_t transacoes;                    // Sessões START..STOP
+} ssd1306_dev_t;
+
+// Fluxo de comandos: um único controle 0x00 seguido de todos os comandos, numa só
+// transação. Com dados, a janela de endereço e o quadro saem na mesma sessão
+// (comandos, RESTART, controle 0x40 e dados).
+#define SSD1306_FLUXO_MAX 32
+
+typedef struct {
+    uint8_t bytes[1 + SSD1306_FLUXO_MAX];   // bytes[0] é o controle 0x00
+    uint8_t tamanho;                        // Quantidade de comandos
+} ssd1306_fluxo_t;
+
+void ssd1306_fluxo_iniciar(ssd1306_fluxo_t *fluxo);
+bool ssd1306_fluxo_adicionar(ssd1306_fluxo_t *fluxo, uint8_t comando);
+bool ssd1306_fluxo_janela(ssd1306_fluxo_t *fluxo, uint8_t col_ini, uint8_t col_fim,
+                          uint8_t pag_ini, uint8_t pag_fim);
+
+// Instância e envio
+bool ssd1306_dev_criar(ssd1306_dev_t *dev, const ssd1306_config_t *cfg, uint8_t *quadro);
+void ssd1306_dev_init(ssd1306_dev_t *dev);
+void ssd1306_dev_rotacao(ssd1306_dev_t *dev, ssd1306_rotacao_t rotacao);
+void ssd1306_dev_comandos(ssd1306_dev_t *dev, const uint8_t *comandos, int quantidade);
+void ssd1306_dev_fluxo_enviar(ssd1306_dev_t *dev, ssd1306_fluxo_t *fluxo, uint8_t *dados, int tamanho);
+void ssd1306_dev_enviar_dados(ssd1306_dev_t *dev, uint8_t *dados, int tamanho);
+
+// Regiões alteradas: o desenho marca o retângulo que escreveu e ssd1306_dev_flush()
+// envia só as colunas sujas de cada página.
+void ssd1306_dev_marcar_sujo(ssd1306_dev_t *dev, int x0, int y0, int x1, int y1);
+void ssd1306_dev_marcar_tudo_sujo(ssd1306_dev_t *dev);
+void ssd1306_dev_limpar_sujo(ssd1306_dev_t *dev, uint8_t pagina_ini, uint8_t pagina_fim);
+bool ssd1306_dev_tem_sujo(const ssd1306_dev_t *dev);
+void ssd1306_dev_flush(ssd1306_dev_t *dev);
+
+// Desenho no quadro da instância
+void ssd1306_dev_limpar(ssd1306_dev_t *dev);
+void ssd1306_dev_limpar_paginas(ssd1306_dev_t *dev, uint8_t pagina_ini, uint8_t pagina_fim);
+void ssd1306_dev_pixel(ssd1306_dev_t *dev, int x, int y, bool aceso);
+void ssd1306_dev_linha(ssd1306_dev_t *dev, int x0, int y0, int x1, int y1, bool aceso);
+void ssd1306_dev_caractere(ssd1306_dev_t *dev, int16_t x, int16_t y, uint8_t caractere);
+void ssd1306_dev_texto(ssd1306_dev_t *dev, int16_t x, int16_t y, const char *texto);
+void ssd1306_dev_texto_utf8(ssd1306_dev_t *dev, int16_t x, int16_t y, const char *utf8);
+void ssd1306_dev_texto_utf8_multilinha(ssd1306_dev_t *dev, int16_t x, int16_t y, const char *utf8);
+
+#endif // SSD1306_DEV_H
@@ -0,0 +1,80 @@
+#ifndef SSD1306_EMULADOR_H
+#define SSD1306_EMULADOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306_dev.h"
+
+// Emulador do controlador para a biblioteca de host: decodifica os bytes do
+// barramento como o SSD1306 (controle Co/D-C, comandos com parâmetros, modos de
+// endereçamento, janela, linha inicial, remapeamentos, contraste, inversão e
+// rolagem horizontal) sobre uma RAM de 128 x 64. O painel é lido da RAM como o
+// display mostraria, e o tempo de cada transação é estimado pelo clock do I2C.
+
+typedef enum {
+    SSD1306_EMULADOR_HORIZONTAL = 0,
+    SSD1306_EMULADOR_VERTICAL,
+    SSD1306_EMULADOR_PAGINA,        // Modo após o reset
+} ssd1306_emulador_modo_t;
+
+typedef struct {
+    uint8_t ram[SSD1306_PAGINAS_MAX][SSD1306_LARGURA_MAX];
+    uint8_t endereco;               // Escritas para outro endereço são NACK (erro)
+    uint8_t largura, altura;        // Painel visível
+
+    // Registradores
+    ssd1306_emulador_modo_t modo;
+    uint8_t col_ini, col_fim;       // Janela dos modos horizontal e vertical
+    uint8_t pag_ini, pag_fim;
+    uint8_t coluna, pagina;         // Ponteiro de escrita
+    uint8_t linha_inicial;
+    uint8_t deslocamento;           // 0xD3
+    uint8_t multiplex;              // Linhas de COM - 1
+    uint8_t contraste;
+    bool segmentos_remapeados;      // 0xA1: coluna 0 à esquerda
+    bool com_remapeado;             // 0xC8: varredura de COM[N-1] a COM0
+    bool invertido;                 // 0xA7
+    bool tudo_aceso;                // 0xA5
+    bool ligado;                    // 0xAF
+
+    // Rolagem horizontal
+    bool rolando;
+    bool rolagem_esquerda;
+    uint8_t rolagem_pag_ini, rolagem_pag_fim;
+    uint16_t rolagem_quadros;       // Quadros por passo
+    uint16_t quadros_contados;
+
+    // Decodificação: comando em andamento e controle da sessão
+    uint8_t comando[8];
+    uint8_t recebidos, esperados;
+    uint8_t estado;
+
+    // Contadores
+    uint32_t bytes;                 // Bytes escritos, sem o endereço
+    uint32_t transacoes;            // Sessões START..STOP
+    uint32_t comandos;              // Comandos completos decodificados
+    uint32_t dados;                 // Bytes gravados na RAM
+    uint32_t escritas_rolando;      // Dados com rolagem ativa (proibido pelo datasheet)
+    uint32_t erros;                 // Endereço errado ou byte de controle inválido
+    uint32_t frequencia_hz;
+    uint64_t bits;                  // Bits no barramento (START, endereço, ACKs, STOP)
+} ssd1306_emulador_t;
+
+// Estado de reset do controlador. 'frequencia_hz' é o clock do I2C modelado.
+void ssd1306_emulador_iniciar(ssd1306_emulador_t *emu, uint8_t largura, uint8_t altura,
+                              uint32_t frequencia_hz);
+void ssd1306_emulador_zerar_contadores(ssd1306_emulador_t *emu);
+ssd1306_barramento_t ssd1306_barramento_emulador(ssd1306_emulador_t *emu);
+
+// Pixel (x, y) do painel como aparece na tela, com linha inicial, deslocamento,
+// remapeamentos, inversão e display desligado.
+bool ssd1306_emulador_pixel(const ssd1306_emulador_t *emu, int x, int y);
+
+// Avança 'quadros' atualizações do painel (só a rolagem depende do tempo).
+void ssd1306_emulador_quadros(ssd1306_emulador_t *emu, uint32_t quadros);
+
+// Tempo de barramento acumulado desde a última zerada, em microssegundos.
+// Quadros por segundo de um driver: 1e6 / tempo de um quadro.
+uint32_t ssd1306_emulador_tempo_us(const ssd1306_emulador_t *emu);
+
+#endif // SSD1306_EMULADOR_H
@@ -25,6 +25,8 @@
 #ifndef SSD1306_FONT_H
 #define SSD1306_FONT_H
 
+#include <stdint.h>
+
 static uint8_t font[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //0: Nothing
     0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, 0x00, //1: A
@@ -118,7 +120,9 @@ static uint8_t font[] = {
     0x00, 0x3A, 0x45, 0x45, 0x45, 0x3A, 0x00, 0x00, //89: ô
     0x00, 0x3c, 0x40, 0x42, 0x41, 0x3c, 0x40, 0x00, //90: ú
     0x00, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //91: , (vírgula)
-    0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, //92: - (vírgula)
+    0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, //92: - (menos)
+    0x00, 0x18, 0x18, 0x7E, 0x7E, 0x18, 0x18, 0x00, //93: + (mais)
+    0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, //94: / (barra)
 
 };
 
@@ -0,0 +1,37 @@
+#ifndef SSD1306_GRANDE_H
+#define SSD1306_GRANDE_H
+
+#include <stdint.h>
+#include "ssd1306_dev.h"
+
+// Glifo grande já no formato do quadro: cada coluna é uma sequência de bytes de
+// página (bit 0 = linha de cima), copiada sem deslocar bits.
+typedef struct {
+    uint8_t largura;            // Colunas
+    uint8_t paginas;            // Altura em páginas de 8 linhas
+    uint8_t passo;              // Bytes entre o início de duas colunas em 'colunas'
+    const uint8_t *colunas;     // colunas[c * passo + p]: página p da coluna c
+} ssd1306_glifo_grande_t;
+
+// Copia o glifo com o topo na página 'pagina' e marca o retângulo como sujo.
+void ssd1306_dev_glifo_grande(ssd1306_dev_t *dev, int x, uint8_t pagina, const ssd1306_glifo_grande_t *glifo);
+
+// Número grande: lembra o glifo e a coluna de cada posição exibida. A cada
+// atualização, só as posições que mudaram são apagadas e redesenhadas, então
+// o flush seguinte envia só os retângulos desses dígitos.
+#define SSD1306_GRANDE_MAX 10
+
+typedef struct {
+    ssd1306_dev_t *dev;
+    uint8_t pagina;                                     // Página do topo
+    uint8_t quantidade;                                 // Posições exibidas
+    int16_t x[SSD1306_GRANDE_MAX];
+    const ssd1306_glifo_grande_t *glifo[SSD1306_GRANDE_MAX];
+} ssd1306_grande_t;
+
+void ssd1306_grande_iniciar(ssd1306_grande_t *grande, ssd1306_dev_t *dev, uint8_t pagina);
+void ssd1306_grande_exibir(ssd1306_grande_t *grande, const int16_t *x,
+                           const ssd1306_glifo_grande_t *const *glifos, int quantidade);
+void ssd1306_grande_esquecer(ssd1306_grande_t *grande);
+
+#endif // SSD1306_GRANDE_H
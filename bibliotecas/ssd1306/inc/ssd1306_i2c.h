@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+#ifndef ssd1306_inc_h
+#define ssd1306_inc_h
+
+#include "ssd1306_comandos.h"
+#include "ssd1306_dev.h"
+
+// Geometria do display padrão (a API global, sem instância). Outras telas usam
+// ssd1306_dev_t com a geometria na configuração.
+#define ssd1306_height 64 // Define a altura do display (64 pixels)
+#define ssd1306_width 128 // Define a largura do display (128 pixels)
+
+#define ssd1306_i2c_address _u(0x3C) // Define o endereço do i2c do display
+
+#define ssd1306_i2c_clock 400 // Define o tempo do clock (pode ser aumentado)
+
+#define ssd1306_n_pages (ssd1306_height / ssd1306_page_height)
+#define ssd1306_buffer_length (ssd1306_n_pages * ssd1306_width)
+
+// Framebuffer com o byte de controle de dados (0x40) reservado logo antes dos pixels,
+// como o ram_buffer de ssd1306_t: o quadro vai para o barramento sem cópia nem heap.
+// As primitivas de desenho recebem 'pixels'.
+typedef struct {
+    uint8_t controle;
+    uint8_t pixels[ssd1306_buffer_length];
+} ssd1306_framebuffer_t;
+
+#define SSD1306_FRAMEBUFFER_INIT { .controle = 0x40 }
+
+struct render_area {
+    uint8_t start_column;
+    uint8_t end_column;
+    uint8_t start_page;
+    uint8_t end_page;
+
+    int buffer_length;
+};
+
+typedef struct {
+  uint8_t width, height, pages, address;
+  i2c_inst_t * i2c_port;
+  bool external_vcc;
+  uint8_t *ram_buffer;
+  size_t bufsize;
+  uint8_t port_buffer[2];
+} ssd1306_t;
+
+#endif
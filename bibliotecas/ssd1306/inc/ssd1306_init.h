@@ -0,0 +1,34 @@
+#ifndef SSD1306_INIT_H
+#define SSD1306_INIT_H
+
+#include "ssd1306_i2c.h"
+
+// API global: opera sobre a instância padrão (128x64, ssd1306_i2c_address, i2c1
+// até ssd1306_init_i2c() escolher outra porta). Os buffers recebidos são os pixels
+// de um ssd1306_framebuffer_t.
+ssd1306_dev_t *ssd1306_padrao(void);
+ssd1306_dev_t *ssd1306_padrao_quadro(uint8_t *buffer);
+
+void ssd1306_fluxo_enviar(ssd1306_fluxo_t *fluxo, uint8_t *dados, int tamanho);
+
+void ssd1306_send_command(uint8_t command);
+void ssd1306_send_command_list(uint8_t *cmd_list, int number);
+void ssd1306_send_buffer(uint8_t *buffer, int length);
+void ssd1306_init(void);
+void ssd1306_init_i2c(i2c_inst_t *i2c, uint8_t endereco);
+void ssd1306_scroll(bool set);
+
+// Modo bitmap: cada ssd1306_t desenha num buffer do chamador com o controle 0x40
+// reservado no início, ex.: static uint8_t tela[SSD1306_BM_TAMANHO(128, 64)].
+// ssd1306_init_bm() retorna false se o buffer for menor que isso.
+#define SSD1306_BM_TAMANHO(largura, altura) ((size_t)(largura) * ((altura) / 8) + 1)
+
+void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+void ssd1306_config(ssd1306_t *ssd);
+bool ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address,
+                     i2c_inst_t *i2c, uint8_t *ram_buffer, size_t tamanho);
+void ssd1306_send_data(ssd1306_t *ssd);
+uint32_t ssd1306_bytes_enviados(void);
+uint32_t ssd1306_transacoes(void);
+
+#endif // SSD1306_INIT_H
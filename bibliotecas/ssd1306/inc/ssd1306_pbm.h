@@ -0,0 +1,17 @@
+#ifndef SSD1306_PBM_H
+#define SSD1306_PBM_H
+
+#include <stdbool.h>
+#include "ssd1306_dev.h"
+#include "ssd1306_emulador.h"
+
+// Só no build sem o SDK: grava o quadro da instância como imagem PBM binária
+// (P4), pixel aceso em preto. Uma imagem por quadro permite conferir telas sem
+// o display.
+bool ssd1306_dev_salvar_pbm(const ssd1306_dev_t *dev, const char *caminho);
+
+// O painel do emulador, como o display mostraria: compara o que chegou pelo
+// barramento com o quadro que o driver pretendia enviar.
+bool ssd1306_emulador_salvar_pbm(const ssd1306_emulador_t *emu, const char *caminho);
+
+#endif // SSD1306_PBM_H
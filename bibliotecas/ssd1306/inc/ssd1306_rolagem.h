@@ -0,0 +1,50 @@
+#ifndef SSD1306_ROLAGEM_H
+#define SSD1306_ROLAGEM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306_dev.h"
+
+// Rolagem sem reenviar a tela: o registrador de linha inicial, a rolagem
+// horizontal do próprio controlador e escritas de uma coluna só.
+
+// Log de texto que rola para cima. A nova linha é escrita na página de RAM que
+// acabou de sair pelo topo e a linha inicial avança 8 pixels: cada linha nova
+// custa uma página, não o quadro inteiro. O log ocupa o display todo (a linha
+// inicial desloca todas as linhas) e o quadro fica na ordem da RAM.
+typedef struct {
+    ssd1306_dev_t *dev;
+    uint8_t topo;           // Página de RAM exibida no topo (linha inicial = topo * 8)
+    uint8_t linhas;         // Linhas escritas até a tela encher
+} ssd1306_log_t;
+
+bool ssd1306_log_iniciar(ssd1306_log_t *log, ssd1306_dev_t *dev);
+void ssd1306_log_adicionar(ssd1306_log_t *log, const char *utf8);
+void ssd1306_log_encerrar(ssd1306_log_t *log);
+
+// Letreiro: o controlador desloca as páginas sozinho, sem tráfego no barramento.
+// 'intervalo' é o código do datasheet (0 = 5 quadros, 7 = 2 quadros, 3 = 256).
+// A RAM não pode ser escrita com a rolagem ativa: pare antes de redesenhar.
+void ssd1306_dev_rolagem_horizontal(ssd1306_dev_t *dev, uint8_t pagina_ini, uint8_t pagina_fim,
+                                    bool para_esquerda, uint8_t intervalo);
+void ssd1306_dev_parar_rolagem(ssd1306_dev_t *dev);
+
+// Gráfico de varredura: cada amostra vira uma coluna na posição do cursor, que
+// avança e dá a volta, com uma coluna apagada à frente. Cada amostra envia só
+// duas colunas numa sessão (janela + dados), nunca a área inteira.
+typedef struct {
+    ssd1306_dev_t *dev;
+    int16_t x;                  // Primeira coluna do gráfico
+    uint8_t largura;            // Colunas (amostras visíveis)
+    uint8_t pagina_ini;
+    uint8_t paginas;
+    float minimo, maximo;       // Escala vertical (valores fora são limitados)
+    uint8_t cursor;             // Coluna da próxima amostra
+    int16_t ultimo_y;           // Linha da amostra anterior (-1 = nenhuma)
+} ssd1306_grafico_t;
+
+void ssd1306_grafico_iniciar(ssd1306_grafico_t *grafico, ssd1306_dev_t *dev, int16_t x, uint8_t largura,
+                             uint8_t pagina_ini, uint8_t paginas, float minimo, float maximo);
+void ssd1306_grafico_adicionar(ssd1306_grafico_t *grafico, float valor);
+
+#endif // SSD1306_ROLAGEM_H
@@ -0,0 +1,8 @@
+#ifndef SSD1306_SEM_HEAP_H
+#define SSD1306_SEM_HEAP_H
+
+// Incluído por último nos arquivos do caminho de atualização do display:
+// qualquer malloc/calloc/realloc/free a partir daqui é erro de compilação.
+#pragma GCC poison malloc calloc realloc free
+
+#endif // SSD1306_SEM_HEAP_H
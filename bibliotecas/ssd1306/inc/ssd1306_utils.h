@@ -0,0 +1,22 @@
+#ifndef SSD1306_UTILS_H
+#define SSD1306_UTILS_H
+
+#include "ssd1306_i2c.h"
+#include "ssd1306_async.h"
+
+void calculate_render_area_buffer_length(struct render_area *area);
+void render_on_display(uint8_t *buffer, struct render_area *area);
+void oled_clear(uint8_t *buffer, struct render_area *area);
+void ssd1306_clear_display(uint8_t *buffer);
+void limpar_oled_com_delay(uint8_t *buffer, struct render_area *area, uint delay_ms);
+void limpar_oled(uint8_t *buffer, struct render_area *area);
+
+// Rastreamento de regiões alteradas: as primitivas de desenho marcam o retângulo que
+// escreveram e ssd1306_flush() envia só as colunas sujas de cada página.
+void ssd1306_marcar_sujo(int x0, int y0, int x1, int y1);
+void ssd1306_marcar_tudo_sujo(void);
+bool ssd1306_tem_sujo(void);
+void ssd1306_flush(uint8_t *buffer);
+bool ssd1306_flush_async(uint8_t *buffer, ssd1306_async_callback_t callback, void *contexto);
+
+#endif // SSD1306_UTILS_H
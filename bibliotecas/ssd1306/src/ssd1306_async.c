@@ -0,0 +1,217 @@
+#include "ssd1306_async.h"
+#include "ssd1306_barramento_i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/timer.h"
+#include "ssd1306_sem_heap.h"
+
+// Porta do último lote: é nela que ssd1306_async_ocupado() olha o barramento.
+static i2c_inst_t *porta = NULL;
+static int canal = -1;
+
+// Lote em montagem/envio: cada palavra vai direto para IC_DATA_CMD.
+static uint16_t lote[SSD1306_ASYNC_MAX_PALAVRAS];
+static uint lote_tamanho = 0;
+
+static volatile bool dma_ativo = false;
+static uint64_t prazo_us = 0;           // Até quando o último lote deve ter saído
+static uint32_t fonte_abort = 0;        // IC_TX_ABRT_SOURCE do último abort
+static ssd1306_async_callback_t callback_fim = NULL;
+static void *contexto_fim = NULL;
+
+// Handler compartilhado do DMA_IRQ_1: o lote inteiro já está no FIFO do I2C.
+static void ssd1306_async_dma_handler(void) {
+    if (canal < 0 || !dma_channel_get_irq1_status(canal)) return;
+
+    dma_channel_acknowledge_irq1(canal);
+    dma_ativo = false;
+    if (callback_fim) callback_fim(contexto_fim);
+}
+
+// Reserva o canal DMA. A porta e o endereço vêm de cada instância no envio;
+// i2c_init() já habilita o DREQ do bloco I2C.
+bool ssd1306_async_init(void) {
+    if (canal >= 0) return true;
+
+    canal = dma_claim_unused_channel(false);
+    if (canal < 0) return false;
+
+    irq_add_shared_handler(DMA_IRQ_1, ssd1306_async_dma_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+    dma_channel_set_irq1_enabled(canal, true);
+    return true;
+}
+
+// Verdadeiro enquanto o DMA alimenta o FIFO ou o I2C ainda transmite.
+bool ssd1306_async_ocupado(void) {
+    if (!porta) return false;
+    if (dma_ativo) return true;
+
+    uint32_t status = i2c_get_hw(porta)->status;
+    return (status & I2C_IC_STATUS_ACTIVITY_BITS) || !(status & I2C_IC_STATUS_TFE_BITS);
+}
+
+// Descarta o lote em curso. O abort do DMA pode levantar a IRQ do canal (RP2040-E13),
+// então ela fica desligada até o reconhecimento. Ler IC_CLR_TX_ABRT libera o FIFO de TX,
+// que o bloco I2C mantém esvaziado desde o abort.
+static ssd1306_async_erro_t cancelar_lote(ssd1306_async_erro_t erro) {
+    i2c_hw_t *hw = i2c_get_hw(porta);
+
+    if (erro == SSD1306_ASYNC_TEMPO_ESGOTADO) {
+        // Barramento travado sem abort: pede ao bloco que solte o barramento e esvazie o FIFO.
+        hw->enable |= I2C_IC_ENABLE_ABORT_BITS;
+        uint64_t limite = time_us_64() + SSD1306_ASYNC_FOLGA_US;
+        while ((hw->enable & I2C_IC_ENABLE_ABORT_BITS) && time_us_64() < limite) {
+            tight_loop_contents();
+        }
+    }
+
+    fonte_abort = hw->tx_abrt_source;
+    dma_channel_set_irq1_enabled(canal, false);
+    dma_channel_abort(canal);
+    dma_channel_acknowledge_irq1(canal);
+    dma_channel_set_irq1_enabled(canal, true);
+    callback_fim = NULL;
+    dma_ativo = false;
+    (void)hw->clr_tx_abrt;
+    return erro;
+}
+
+// Espera o DMA (so_dma) ou também o barramento, até o prazo do último lote.
+static ssd1306_async_erro_t esperar(bool so_dma) {
+    while (so_dma ? dma_ativo : ssd1306_async_ocupado()) {
+        if (i2c_get_hw(porta)->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+            return cancelar_lote(SSD1306_ASYNC_ABORTADO);
+        }
+        if (time_us_64() > prazo_us) {
+            return cancelar_lote(SSD1306_ASYNC_TEMPO_ESGOTADO);
+        }
+        tight_loop_contents();
+    }
+    return SSD1306_ASYNC_OK;
+}
+
+// Usado pelo caminho bloqueante antes de escrever no barramento.
+ssd1306_async_erro_t ssd1306_async_aguardar(void) {
+    return esperar(false);
+}
+
+// Motivo do último ABORTADO, como em IC_TX_ABRT_SOURCE (ex.: bit 0 = endereço sem ACK).
+uint32_t ssd1306_async_fonte_abort(void) {
+    return fonte_abort;
+}
+
+// Começa um lote novo. Só espera o DMA (não o barramento): o lote anterior pode
+// continuar saindo do FIFO enquanto este é montado.
+ssd1306_async_erro_t ssd1306_async_iniciar_lote(void) {
+    ssd1306_async_erro_t erro = esperar(true);
+    lote_tamanho = 0;
+    return erro;
+}
+
+// Acrescenta um trecho: controle + bytes. 'inicio' marca o controle (RESTART ao
+// emendar na sessão anterior) e 'fim' vai no último byte (STOP).
+static bool adicionar_trecho(uint8_t controle, const uint8_t *bytes, int tamanho,
+                             uint16_t inicio, uint16_t fim) {
+    if (lote_tamanho + 1 + tamanho > SSD1306_ASYNC_MAX_PALAVRAS) return false;
+
+    lote[lote_tamanho++] = controle | inicio;
+    for (int i = 0; i < tamanho; i++) {
+        lote[lote_tamanho++] = bytes[i];
+    }
+    lote[lote_tamanho - 1] |= fim;
+    return true;
+}
+
+// Todos os comandos numa transação, com um único controle 0x00.
+bool ssd1306_async_comandos(const uint8_t *comandos, int quantidade) {
+    return adicionar_trecho(0x00, comandos, quantidade, 0, I2C_IC_DATA_CMD_STOP_BITS);
+}
+
+bool ssd1306_async_dados(const uint8_t *dados, int tamanho) {
+    return adicionar_trecho(0x40, dados, tamanho, 0, I2C_IC_DATA_CMD_STOP_BITS);
+}
+
+// Janela de endereço e dados na mesma sessão: comandos, RESTART, dados, STOP.
+bool ssd1306_async_janela(const uint8_t *comandos, int quantidade, const uint8_t *dados, int tamanho) {
+    if (lote_tamanho + 2 + quantidade + tamanho > SSD1306_ASYNC_MAX_PALAVRAS) return false;
+
+    adicionar_trecho(0x00, comandos, quantidade, 0, 0);
+    return adicionar_trecho(0x40, dados, tamanho, I2C_IC_DATA_CMD_RESTART_BITS, I2C_IC_DATA_CMD_STOP_BITS);
+}
+
+// Dispara o lote para a porta e o endereço da instância. O callback (opcional)
+// é chamado no fim do DMA.
+bool ssd1306_async_enviar(ssd1306_dev_t *dev, ssd1306_async_callback_t callback, void *contexto) {
+    if (canal < 0 || lote_tamanho == 0 || dma_ativo) return false;
+    if (!ssd1306_barramento_e_i2c(&dev->cfg.barramento)) return false;
+
+    i2c_inst_t *i2c = dev->cfg.barramento.porta;
+    i2c_hw_t *hw = i2c_get_hw(i2c);
+
+    // Troca a porta ou o endereço alvo só com o barramento parado, como faz
+    // i2c_write_blocking(). Com o mesmo alvo, o lote entra no FIFO atrás dos
+    // últimos bytes do anterior.
+    if (i2c != porta || hw->tar != dev->cfg.endereco || !hw->enable) {
+        if (ssd1306_async_aguardar() != SSD1306_ASYNC_OK) return false;
+        hw->enable = 0;
+        hw->tar = dev->cfg.endereco;
+        hw->enable = 1;
+    }
+
+    if (i2c != porta) {
+        // Escritas de 16 bits em IC_DATA_CMD, ritmadas pelo DREQ de TX desta porta.
+        dma_channel_config cfg = dma_channel_get_default_config(canal);
+        channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+        channel_config_set_read_increment(&cfg, true);
+        channel_config_set_write_increment(&cfg, false);
+        channel_config_set_dreq(&cfg, i2c_get_dreq(i2c, true));
+        dma_channel_configure(canal, &cfg, &hw->data_cmd, lote, 0, false);
+        porta = i2c;
+    }
+
+    dev->bytes_enviados += lote_tamanho;
+    for (uint i = 0; i < lote_tamanho; i++) {
+        if (lote[i] & I2C_IC_DATA_CMD_STOP_BITS) dev->transacoes++;
+    }
+
+    // Atrás do lote anterior, se ele ainda está saindo do FIFO.
+    uint64_t agora = time_us_64();
+    prazo_us = (prazo_us > agora ? prazo_us : agora) +
+               lote_tamanho * SSD1306_ASYNC_US_POR_PALAVRA + SSD1306_ASYNC_FOLGA_US;
+
+    callback_fim = callback;
+    contexto_fim = contexto;
+    dma_ativo = true;
+    dma_channel_transfer_from_buffer_now(canal, lote, lote_tamanho);
+    return true;
+}
+
+// --------------------------------------------------------------
+// Flush assíncrono: monta as janelas sujas da instância num lote
+// DMA e retorna logo; o quadro já pode ser redesenhado. Retorna
+// false se não havia nada sujo (o callback não será chamado), se
+// o lote não coube, se a instância não está num barramento I2C ou
+// se o lote anterior abortou ou esgotou o prazo (as faixas sujas
+// continuam marcadas para a próxima tentativa).
+// --------------------------------------------------------------
+bool ssd1306_dev_flush_async(ssd1306_dev_t *dev, ssd1306_async_callback_t callback, void *contexto) {
+    if (!ssd1306_barramento_e_i2c(&dev->cfg.barramento)) return false;
+    if (!ssd1306_dev_tem_sujo(dev)) return false;
+
+    if (ssd1306_async_iniciar_lote() != SSD1306_ASYNC_OK) return false;
+    for (uint8_t p = 0; p < dev->paginas; p++) {
+        if (dev->sujo_x0[p] > dev->sujo_x1[p]) continue;
+
+        uint8_t commands[] = {
+            ssd1306_set_column_address, dev->sujo_x0[p], dev->sujo_x1[p],
+            ssd1306_set_page_address, p, p
+        };
+        ssd1306_async_janela(commands, sizeof(commands),
+                             dev->pixels + p * dev->cfg.largura + dev->sujo_x0[p],
+                             dev->sujo_x1[p] - dev->sujo_x0[p] + 1);
+
+        ssd1306_dev_limpar_sujo(dev, p, p);
+    }
+    return ssd1306_async_enviar(dev, callback, contexto);
+}
@@ -0,0 +1,29 @@
+#include "ssd1306_barramento_falso.h"
+#include <string.h>
+#include "ssd1306_sem_heap.h"
+
+static void escrever_falso(void *porta, uint8_t endereco, const uint8_t *bytes,
+                           size_t tamanho, bool sem_stop) {
+    ssd1306_falso_t *falso = porta;
+
+    size_t livres = SSD1306_FALSO_REGISTRO - falso->tamanho;
+    size_t copiar = tamanho < livres ? tamanho : livres;
+    memcpy(falso->registro + falso->tamanho, bytes, copiar);
+    falso->tamanho += copiar;
+
+    falso->bytes += tamanho;
+    if (!sem_stop) falso->transacoes++;
+    falso->endereco = endereco;
+}
+
+void ssd1306_falso_limpar(ssd1306_falso_t *falso) {
+    falso->tamanho = 0;
+    falso->bytes = 0;
+    falso->transacoes = 0;
+    falso->endereco = 0;
+}
+
+ssd1306_barramento_t ssd1306_barramento_falso(ssd1306_falso_t *falso) {
+    ssd1306_falso_limpar(falso);
+    return (ssd1306_barramento_t){ .escrever = escrever_falso, .porta = falso };
+}
@@ -0,0 +1,31 @@
+#include "ssd1306_barramento_i2c.h"
+#include "ssd1306_async.h"
+#include "ssd1306_sem_heap.h"
+
+// Por bloco I2C, verdadeiro entre uma escrita 'sem_stop' e a seguinte: o mestre
+// segura aquele barramento (ACTIVITY continua ligado), então não há o que esperar.
+// Uma sessão aberta em i2c0 não dispensa a espera de quem escreve em i2c1.
+static bool sessao_aberta[NUM_I2CS];
+
+static void escrever_i2c(void *porta, uint8_t endereco, const uint8_t *bytes,
+                         size_t tamanho, bool sem_stop) {
+    i2c_inst_t *i2c = porta;
+    uint indice = i2c_hw_index(i2c);
+
+    if (!sessao_aberta[indice]) {
+        // Não intercala com um lote DMA em andamento. Se ele abortou, já foi descartado
+        // e o barramento está livre; um NAK desta escrita vem de i2c_write_blocking.
+        ssd1306_async_aguardar();
+    }
+    i2c_write_blocking(i2c, endereco, bytes, tamanho, sem_stop);
+    sessao_aberta[indice] = sem_stop;
+}
+
+ssd1306_barramento_t ssd1306_barramento_i2c(i2c_inst_t *i2c) {
+    return (ssd1306_barramento_t){ .escrever = escrever_i2c, .porta = i2c };
+}
+
+// O DMA de ssd1306_async só sabe falar com um bloco I2C de verdade.
+bool ssd1306_barramento_e_i2c(const ssd1306_barramento_t *barramento) {
+    return barramento->escrever == escrever_i2c;
+}
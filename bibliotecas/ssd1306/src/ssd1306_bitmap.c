@@ -1,4 +1,5 @@
 #include "ssd1306_bitmap.h"
+#include "ssd1306_init.h"
 
 void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
     for (int i = 0; i < ssd->bufsize - 1; i++) {
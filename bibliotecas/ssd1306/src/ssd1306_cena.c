@@ -0,0 +1,251 @@
+/**
+ * ssd1306_cena.c
+ *
+ * Elementos retidos sobre uma instância: cada alteração marca o elemento e a
+ * atualização redesenha só as caixas marcadas, com um flush das regiões sujas.
+ */
+
+#include "ssd1306_cena.h"
+#include <string.h>
+#include "ssd1306_sem_heap.h"
+
+#define LARGURA_CARACTERE 8
+#define ALTURA_CARACTERE 8
+
+// Prazo vencido, inclusive quando o contador de milissegundos dá a volta.
+static bool vencido(uint32_t agora_ms, uint32_t prazo_ms) {
+    return (int32_t)(agora_ms - prazo_ms) >= 0;
+}
+
+// --------------------------------------------------------------
+// Acende ou apaga o retângulo (x0, y0)-(x1, y1), uma máscara de
+// bits por página em vez de pixel a pixel
+// --------------------------------------------------------------
+static void preencher(ssd1306_dev_t *dev, int x0, int y0, int x1, int y1, bool aceso) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > dev->cfg.largura - 1) x1 = dev->cfg.largura - 1;
+    if (y1 > dev->cfg.altura - 1) y1 = dev->cfg.altura - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    for (int p = y0 / 8; p <= y1 / 8; p++) {
+        int topo = p * 8 > y0 ? 0 : y0 - p * 8;
+        int base = p * 8 + 7 < y1 ? 7 : y1 - p * 8;
+        uint8_t mascara = (uint8_t)((0xFF << topo) & (0xFF >> (7 - base)));
+
+        uint8_t *linha = dev->pixels + p * dev->cfg.largura;
+        for (int x = x0; x <= x1; x++) {
+            linha[x] = aceso ? (linha[x] | mascara) : (linha[x] & ~mascara);
+        }
+    }
+    ssd1306_dev_marcar_sujo(dev, x0, y0, x1, y1);
+}
+
+// Quantidade de caracteres (não de bytes) de uma string UTF-8.
+static int contar_caracteres(const char *utf8) {
+    int n = 0;
+    for (; *utf8; utf8++) {
+        if (((uint8_t)*utf8 & 0xC0) != 0x80) n++;
+    }
+    return n;
+}
+
+// Avança até 'n' caracteres UTF-8.
+static const char *avancar_caracteres(const char *utf8, int n) {
+    while (*utf8 && n > 0) {
+        utf8++;
+        while (((uint8_t)*utf8 & 0xC0) == 0x80) utf8++;
+        n--;
+    }
+    return utf8;
+}
+
+// Texto quebrado em '\n' ou a cada 'largura / 8' caracteres, até 'altura / 8' linhas.
+static void desenhar_texto(ssd1306_dev_t *dev, const ssd1306_elemento_t *elemento) {
+    const int por_linha = elemento->largura / LARGURA_CARACTERE;
+    const int linhas = elemento->altura / ALTURA_CARACTERE;
+    if (por_linha == 0) return;
+
+    const char *inicio = elemento->texto;
+    for (int l = 0; l < linhas && *inicio; l++) {
+        const char *fim = avancar_caracteres(inicio, por_linha);
+        const char *quebra = memchr(inicio, '\n', fim - inicio);
+        if (quebra) fim = quebra;
+
+        char linha[SSD1306_ELEMENTO_TEXTO_MAX];
+        memcpy(linha, inicio, fim - inicio);
+        linha[fim - inicio] = '\0';
+
+        int x = elemento->x;
+        if (elemento->centralizar) {
+            x += (elemento->largura - contar_caracteres(linha) * LARGURA_CARACTERE) / 2;
+        }
+        ssd1306_dev_texto_utf8(dev, x, elemento->y + l * ALTURA_CARACTERE, linha);
+        inicio = quebra ? quebra + 1 : fim;
+    }
+}
+
+// Contorno de 1 pixel e preenchimento proporcional, com 1 pixel de folga.
+static void desenhar_barra(ssd1306_dev_t *dev, const ssd1306_elemento_t *elemento) {
+    int x0 = elemento->x, y0 = elemento->y;
+    int x1 = x0 + elemento->largura - 1, y1 = y0 + elemento->altura - 1;
+
+    preencher(dev, x0, y0, x1, y0, true);
+    preencher(dev, x0, y1, x1, y1, true);
+    preencher(dev, x0, y0, x0, y1, true);
+    preencher(dev, x1, y0, x1, y1, true);
+
+    int interno = elemento->largura - 4;
+    int cheio = interno * elemento->porcento / 100;
+    if (cheio > 0) {
+        preencher(dev, x0 + 2, y0 + 2, x0 + 1 + cheio, y1 - 2, true);
+    }
+}
+
+static void desenhar(ssd1306_dev_t *dev, const ssd1306_elemento_t *elemento) {
+    preencher(dev, elemento->x, elemento->y,
+              elemento->x + elemento->largura - 1, elemento->y + elemento->altura - 1, false);
+    if (!elemento->visivel) return;
+
+    if (elemento->tipo == SSD1306_ELEMENTO_BARRA) {
+        desenhar_barra(dev, elemento);
+    } else {
+        desenhar_texto(dev, elemento);
+    }
+}
+
+void ssd1306_cena_iniciar(ssd1306_cena_t *cena, ssd1306_dev_t *dev) {
+    cena->dev = dev;
+    cena->quantidade = 0;
+    cena->pendente = false;
+    cena->alarme = 0;
+}
+
+static ssd1306_elemento_t *novo_elemento(ssd1306_cena_t *cena, ssd1306_elemento_tipo_t tipo,
+                                         int16_t x, int16_t y, uint8_t largura, uint8_t altura) {
+    if (cena->quantidade >= SSD1306_CENA_MAX_ELEMENTOS) return NULL;
+
+    ssd1306_elemento_t *elemento = &cena->elementos[cena->quantidade++];
+    memset(elemento, 0, sizeof(*elemento));
+    elemento->tipo = tipo;
+    elemento->x = x;
+    elemento->y = y;
+    elemento->largura = largura;
+    elemento->altura = altura;
+    elemento->visivel = true;
+    elemento->sujo = true;
+    return elemento;
+}
+
+// --------------------------------------------------------------
+// Rótulo ou campo de valor. Retorna NULL se a cena estiver cheia
+// --------------------------------------------------------------
+ssd1306_elemento_t *ssd1306_cena_texto(ssd1306_cena_t *cena, int16_t x, int16_t y,
+                                       uint8_t largura, uint8_t altura, const char *texto) {
+    ssd1306_elemento_t *elemento = novo_elemento(cena, SSD1306_ELEMENTO_TEXTO, x, y, largura, altura);
+    if (elemento && texto) ssd1306_elemento_texto(elemento, texto);
+    return elemento;
+}
+
+ssd1306_elemento_t *ssd1306_cena_barra(ssd1306_cena_t *cena, int16_t x, int16_t y,
+                                       uint8_t largura, uint8_t altura) {
+    return novo_elemento(cena, SSD1306_ELEMENTO_BARRA, x, y, largura, altura);
+}
+
+// Depois que o quadro foi apagado ou desenhado por fora.
+void ssd1306_cena_redesenhar(ssd1306_cena_t *cena) {
+    for (int i = 0; i < cena->quantidade; i++) {
+        cena->elementos[i].sujo = true;
+    }
+}
+
+bool ssd1306_cena_tem_sujo(const ssd1306_cena_t *cena) {
+    for (int i = 0; i < cena->quantidade; i++) {
+        if (cena->elementos[i].sujo) return true;
+    }
+    return false;
+}
+
+// --------------------------------------------------------------
+// Vence os prazos (piscar, temporários), redesenha os elementos
+// marcados e envia as regiões sujas. Retorna quantos ms faltam
+// para o próximo prazo (SSD1306_CENA_SEM_PRAZO se não houver)
+// --------------------------------------------------------------
+uint32_t ssd1306_cena_atualizar(ssd1306_cena_t *cena, uint32_t agora_ms) {
+    uint32_t proximo = SSD1306_CENA_SEM_PRAZO;
+
+    for (int i = 0; i < cena->quantidade; i++) {
+        ssd1306_elemento_t *elemento = &cena->elementos[i];
+
+        if (elemento->temporario) {
+            if (vencido(agora_ms, elemento->expira_ms)) {
+                elemento->temporario = false;
+                elemento->texto[0] = '\0';
+                elemento->sujo = true;
+            } else if (elemento->expira_ms - agora_ms < proximo) {
+                proximo = elemento->expira_ms - agora_ms;
+            }
+        }
+
+        if (elemento->piscando) {
+            if (vencido(agora_ms, elemento->proxima_troca_ms)) {
+                elemento->visivel = !elemento->visivel;
+                elemento->proxima_troca_ms = agora_ms + elemento->intervalo_ms;
+                elemento->sujo = true;
+            }
+            if (elemento->proxima_troca_ms - agora_ms < proximo) {
+                proximo = elemento->proxima_troca_ms - agora_ms;
+            }
+        }
+
+        // Desmarca antes de desenhar: uma alteração feita no meio do desenho
+        // (de uma interrupção) fica para a próxima atualização.
+        if (elemento->sujo) {
+            elemento->sujo = false;
+            desenhar(cena->dev, elemento);
+        }
+    }
+
+    if (ssd1306_dev_tem_sujo(cena->dev)) {
+        ssd1306_dev_flush(cena->dev);
+    }
+    return proximo;
+}
+
+// Só marca se o texto mudou.
+void ssd1306_elemento_texto(ssd1306_elemento_t *elemento, const char *texto) {
+    elemento->temporario = false;
+    if (strncmp(elemento->texto, texto, sizeof(elemento->texto) - 1) == 0) return;
+
+    strncpy(elemento->texto, texto, sizeof(elemento->texto) - 1);
+    elemento->texto[sizeof(elemento->texto) - 1] = '\0';
+    elemento->sujo = true;
+}
+
+// Texto que some sozinho depois de 'duracao_ms', sem bloquear quem chamou.
+void ssd1306_elemento_temporario(ssd1306_elemento_t *elemento, const char *texto,
+                                 uint32_t duracao_ms, uint32_t agora_ms) {
+    ssd1306_elemento_texto(elemento, texto);
+    elemento->temporario = true;
+    elemento->expira_ms = agora_ms + duracao_ms;
+}
+
+void ssd1306_elemento_porcento(ssd1306_elemento_t *elemento, uint8_t porcento) {
+    if (porcento > 100) porcento = 100;
+    if (porcento == elemento->porcento) return;
+
+    elemento->porcento = porcento;
+    elemento->sujo = true;
+}
+
+// Ao parar de piscar o elemento volta a ficar visível.
+void ssd1306_elemento_piscar(ssd1306_elemento_t *elemento, bool piscar,
+                             uint32_t intervalo_ms, uint32_t agora_ms) {
+    elemento->piscando = piscar;
+    elemento->intervalo_ms = intervalo_ms;
+    elemento->proxima_troca_ms = agora_ms + intervalo_ms;
+    if (!elemento->visivel || piscar) {
+        elemento->visivel = true;
+        elemento->sujo = true;
+    }
+}
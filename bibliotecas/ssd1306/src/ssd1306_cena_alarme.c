@@ -0,0 +1,31 @@
+#include "pico/time.h"
+#include "ssd1306_cena.h"
+#include "ssd1306_sem_heap.h"
+
+// Roda na interrupção do alarme: só avisa o laço principal.
+static int64_t prazo_vencido(alarm_id_t id, void *dados) {
+    ssd1306_cena_t *cena = dados;
+    cena->alarme = 0;
+    cena->pendente = true;
+    return 0;
+}
+
+// --------------------------------------------------------------
+// Atualiza a cena se algum elemento mudou ou se o alarme avisou
+// que um prazo venceu, e arma o alarme para o próximo prazo
+// --------------------------------------------------------------
+void ssd1306_cena_processar(ssd1306_cena_t *cena) {
+    if (!cena->pendente && !ssd1306_cena_tem_sujo(cena)) return;
+    cena->pendente = false;
+
+    if (cena->alarme > 0) {
+        cancel_alarm(cena->alarme);
+        cena->alarme = 0;
+    }
+
+    uint32_t prazo = ssd1306_cena_atualizar(cena, to_ms_since_boot(get_absolute_time()));
+    if (prazo != SSD1306_CENA_SEM_PRAZO) {
+        alarm_id_t id = add_alarm_in_ms(prazo, prazo_vencido, cena, true);
+        if (id > 0) cena->alarme = id;
+    }
+}
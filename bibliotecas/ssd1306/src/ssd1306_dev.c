@@ -0,0 +1,232 @@
+#include "ssd1306_dev.h"
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_sem_heap.h"
+
+// Uma transação no barramento da instância, contabilizada: bytes escritos e
+// sessões START..STOP (uma escrita 'sem_stop' continua na seguinte).
+static void escrever(ssd1306_dev_t *dev, const uint8_t *bytes, size_t tamanho, bool sem_stop) {
+    dev->cfg.barramento.escrever(dev->cfg.barramento.porta, dev->cfg.endereco, bytes, tamanho, sem_stop);
+    dev->bytes_enviados += tamanho;
+    if (!sem_stop) dev->transacoes++;
+}
+
+// --------------------------------------------------------------
+// Prepara a instância, sem tocar no barramento. 'quadro' tem
+// SSD1306_QUADRO_TAMANHO(largura, altura) bytes (ou ssd1306_framebuffer_t)
+// e pode ser NULL se o quadro for associado depois em dev->pixels.
+// --------------------------------------------------------------
+bool ssd1306_dev_criar(ssd1306_dev_t *dev, const ssd1306_config_t *cfg, uint8_t *quadro) {
+    if (!cfg->barramento.escrever) return false;
+    if (cfg->largura == 0 || cfg->largura > SSD1306_LARGURA_MAX) return false;
+    if (cfg->altura < 16 || cfg->altura > SSD1306_ALTURA_MAX || cfg->altura % 8) return false;
+
+    dev->cfg = *cfg;
+    dev->paginas = cfg->altura / 8;
+    dev->pixels = NULL;
+    if (quadro) {
+        quadro[0] = 0x40;
+        dev->pixels = quadro + 1;
+        memset(dev->pixels, 0, dev->cfg.largura * dev->paginas);
+    }
+    ssd1306_dev_limpar_sujo(dev, 0, SSD1306_PAGINAS_MAX - 1);
+    dev->bytes_enviados = 0;
+    dev->transacoes = 0;
+    return true;
+}
+
+// Sequência de inicialização para a geometria, rotação e alimentação da instância.
+void ssd1306_dev_init(ssd1306_dev_t *dev) {
+    bool invertido = dev->cfg.rotacao == SSD1306_ROTACAO_180;
+    uint8_t cmds[] = {
+        ssd1306_set_display,
+        ssd1306_set_memory_mode, 0x00,
+        ssd1306_set_display_start_line,
+        ssd1306_set_segment_remap | (invertido ? 0x00 : 0x01),
+        ssd1306_set_mux_ratio, dev->cfg.altura - 1,
+        ssd1306_set_common_output_direction | (invertido ? 0x00 : 0x08),
+        ssd1306_set_display_offset, 0x00,
+        ssd1306_set_common_pin_configuration, dev->cfg.altura > 32 ? 0x12 : 0x02,
+        ssd1306_set_display_clock_divide_ratio, 0x80,
+        ssd1306_set_precharge, dev->cfg.vcc_externo ? 0x22 : 0xF1,
+        ssd1306_set_vcomh_deselect_level, 0x30,
+        ssd1306_set_contrast, 0xFF,
+        ssd1306_set_entire_on,
+        ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, dev->cfg.vcc_externo ? 0x10 : 0x14,
+        ssd1306_set_scroll | 0x00,
+        ssd1306_set_display | 0x01,
+    };
+    ssd1306_dev_comandos(dev, cmds, sizeof(cmds));
+}
+
+// Gira a tela em 180 graus (ou volta). O remapeamento de segmentos só vale para
+// dados escritos depois, então o quadro inteiro fica sujo para o próximo flush.
+void ssd1306_dev_rotacao(ssd1306_dev_t *dev, ssd1306_rotacao_t rotacao) {
+    bool invertido = rotacao == SSD1306_ROTACAO_180;
+    uint8_t cmds[] = {
+        ssd1306_set_segment_remap | (invertido ? 0x00 : 0x01),
+        ssd1306_set_common_output_direction | (invertido ? 0x00 : 0x08),
+    };
+
+    dev->cfg.rotacao = rotacao;
+    ssd1306_dev_comandos(dev, cmds, sizeof(cmds));
+    ssd1306_dev_marcar_tudo_sujo(dev);
+}
+
+void ssd1306_fluxo_iniciar(ssd1306_fluxo_t *fluxo) {
+    fluxo->bytes[0] = 0x00;
+    fluxo->tamanho = 0;
+}
+
+bool ssd1306_fluxo_adicionar(ssd1306_fluxo_t *fluxo, uint8_t comando) {
+    if (fluxo->tamanho >= SSD1306_FLUXO_MAX) return false;
+    fluxo->bytes[1 + fluxo->tamanho++] = comando;
+    return true;
+}
+
+// Acrescenta os comandos de janela (colunas e páginas) usados antes dos dados.
+bool ssd1306_fluxo_janela(ssd1306_fluxo_t *fluxo, uint8_t col_ini, uint8_t col_fim,
+                          uint8_t pag_ini, uint8_t pag_fim) {
+    if (fluxo->tamanho + 6 > SSD1306_FLUXO_MAX) return false;
+    ssd1306_fluxo_adicionar(fluxo, ssd1306_set_column_address);
+    ssd1306_fluxo_adicionar(fluxo, col_ini);
+    ssd1306_fluxo_adicionar(fluxo, col_fim);
+    ssd1306_fluxo_adicionar(fluxo, ssd1306_set_page_address);
+    ssd1306_fluxo_adicionar(fluxo, pag_ini);
+    ssd1306_fluxo_adicionar(fluxo, pag_fim);
+    return true;
+}
+
+// Envia os comandos numa transação. Com 'dados' (dentro de um quadro), a transação
+// não termina: o barramento emite RESTART e os dados seguem na mesma sessão.
+void ssd1306_dev_fluxo_enviar(ssd1306_dev_t *dev, ssd1306_fluxo_t *fluxo, uint8_t *dados, int tamanho) {
+    bool com_dados = dados && tamanho > 0;
+
+    if (fluxo->tamanho > 0) {
+        escrever(dev, fluxo->bytes, fluxo->tamanho + 1, com_dados);
+    }
+    if (com_dados) {
+        ssd1306_dev_enviar_dados(dev, dados, tamanho);
+    }
+    ssd1306_fluxo_iniciar(fluxo);
+}
+
+// Lista inteira numa transação (em blocos de SSD1306_FLUXO_MAX, se for maior).
+void ssd1306_dev_comandos(ssd1306_dev_t *dev, const uint8_t *comandos, int quantidade) {
+    ssd1306_fluxo_t fluxo;
+    ssd1306_fluxo_iniciar(&fluxo);
+
+    for (int i = 0; i < quantidade; i++) {
+        if (!ssd1306_fluxo_adicionar(&fluxo, comandos[i])) {
+            ssd1306_dev_fluxo_enviar(dev, &fluxo, NULL, 0);
+            ssd1306_fluxo_adicionar(&fluxo, comandos[i]);
+        }
+    }
+    ssd1306_dev_fluxo_enviar(dev, &fluxo, NULL, 0);
+}
+
+// 'dados' deve apontar para dentro de um quadro: o byte anterior (o controle
+// reservado, ou o pixel vizinho num trecho parcial) recebe 0x40 durante a
+// transmissão e é restaurado em seguida.
+void ssd1306_dev_enviar_dados(ssd1306_dev_t *dev, uint8_t *dados, int tamanho) {
+    uint8_t *quadro = dados - 1;
+    uint8_t salvo = *quadro;
+
+    *quadro = 0x40;
+    escrever(dev, quadro, tamanho + 1, false);
+    *quadro = salvo;
+}
+
+void ssd1306_dev_limpar_sujo(ssd1306_dev_t *dev, uint8_t pagina_ini, uint8_t pagina_fim) {
+    for (uint8_t p = pagina_ini; p <= pagina_fim && p < SSD1306_PAGINAS_MAX; p++) {
+        dev->sujo_x0[p] = 0xFF;
+        dev->sujo_x1[p] = 0;
+    }
+}
+
+// Marca o retângulo (x0, y0)-(x1, y1), em pixels, como alterado.
+void ssd1306_dev_marcar_sujo(ssd1306_dev_t *dev, int x0, int y0, int x1, int y1) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > dev->cfg.largura - 1) x1 = dev->cfg.largura - 1;
+    if (y1 > dev->cfg.altura - 1) y1 = dev->cfg.altura - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    for (int p = y0 / 8; p <= y1 / 8; p++) {
+        if (x0 < dev->sujo_x0[p]) dev->sujo_x0[p] = x0;
+        if (x1 > dev->sujo_x1[p]) dev->sujo_x1[p] = x1;
+    }
+}
+
+void ssd1306_dev_marcar_tudo_sujo(ssd1306_dev_t *dev) {
+    ssd1306_dev_marcar_sujo(dev, 0, 0, dev->cfg.largura - 1, dev->cfg.altura - 1);
+}
+
+bool ssd1306_dev_tem_sujo(const ssd1306_dev_t *dev) {
+    for (int p = 0; p < dev->paginas; p++) {
+        if (dev->sujo_x0[p] <= dev->sujo_x1[p]) return true;
+    }
+    return false;
+}
+
+// Envia ao display apenas as faixas sujas, uma sessão (janela + dados) por página.
+void ssd1306_dev_flush(ssd1306_dev_t *dev) {
+    ssd1306_fluxo_t fluxo;
+    ssd1306_fluxo_iniciar(&fluxo);
+
+    for (uint8_t p = 0; p < dev->paginas; p++) {
+        if (dev->sujo_x0[p] > dev->sujo_x1[p]) continue;
+
+        ssd1306_fluxo_janela(&fluxo, dev->sujo_x0[p], dev->sujo_x1[p], p, p);
+        ssd1306_dev_fluxo_enviar(dev, &fluxo, dev->pixels + p * dev->cfg.largura + dev->sujo_x0[p],
+                                 dev->sujo_x1[p] - dev->sujo_x0[p] + 1);
+
+        ssd1306_dev_limpar_sujo(dev, p, p);
+    }
+}
+
+// Zera as páginas dadas. Só as colunas que tinham algo aceso ficam sujas,
+// então limpar e redesenhar o mesmo texto custa apenas esse texto.
+void ssd1306_dev_limpar_paginas(ssd1306_dev_t *dev, uint8_t pagina_ini, uint8_t pagina_fim) {
+    for (uint8_t p = pagina_ini; p <= pagina_fim && p < dev->paginas; p++) {
+        uint8_t *linha = dev->pixels + p * dev->cfg.largura;
+        int x0 = 0, x1 = dev->cfg.largura - 1;
+
+        while (x0 <= x1 && linha[x0] == 0) x0++;
+        while (x1 >= x0 && linha[x1] == 0) x1--;
+
+        if (x0 <= x1) {
+            ssd1306_dev_marcar_sujo(dev, x0, p * 8, x1, p * 8 + 7);
+            memset(linha + x0, 0x00, x1 - x0 + 1);
+        }
+    }
+}
+
+void ssd1306_dev_limpar(ssd1306_dev_t *dev) {
+    ssd1306_dev_limpar_paginas(dev, 0, dev->paginas - 1);
+}
+
+void ssd1306_dev_pixel(ssd1306_dev_t *dev, int x, int y, bool aceso) {
+    if (x < 0 || x >= dev->cfg.largura || y < 0 || y >= dev->cfg.altura) return;
+    int index = (y / 8) * dev->cfg.largura + x;
+    if (aceso)
+        dev->pixels[index] |= (1 << (y % 8));
+    else
+        dev->pixels[index] &= ~(1 << (y % 8));
+    ssd1306_dev_marcar_sujo(dev, x, y, x, y);
+}
+
+// Algoritmo de Bresenham básico
+void ssd1306_dev_linha(ssd1306_dev_t *dev, int x0, int y0, int x1, int y1, bool aceso) {
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy, e2;
+    while (1) {
+        ssd1306_dev_pixel(dev, x0, y0, aceso);
+        if (x0 == x1 && y0 == y1) break;
+        e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
@@ -0,0 +1,220 @@
+/**
+ * ssd1306_dev_texto.c
+ *
+ * Texto 8x8 no quadro de uma instância: caracteres, strings ASCII e strings UTF-8
+ * básicas (2 bytes, convertidas para Latin-1), com ou sem quebra de linha.
+ * A fonte é a de ssd1306_font.h, com letras acentuadas e minúsculas.
+ *
+ * Cada glifo é copiado coluna a coluna: com 'y' múltiplo de 8 os 8 bytes vão
+ * direto para a página; fora disso, cada coluna é deslocada numa palavra de
+ * 16 bits que cobre as duas páginas atingidas, sem passar por pixels.
+ */
+
+#include "ssd1306_dev.h"
+#include "ssd1306_font.h"
+#include "ssd1306_sem_heap.h"
+
+#define LARGURA_CARACTERE 8
+#define ALTURA_CARACTERE 8
+
+// ------------------------------------------------------------
+// Índice do caractere (Latin-1) no array `font`
+// ------------------------------------------------------------
+static int ssd1306_get_font(uint8_t character) {
+    if (character >= 'A' && character <= 'Z') return character - 'A' + 1;
+    if (character >= '0' && character <= '9') return character - '0' + 27;
+    if (character >= 'a' && character <= 'z') return character - 'a' + 37;
+    if (character == '.') return 63;
+    if (character == ':') return 64;
+    if (character == 0x23) return 65;  // #
+    if (character == 0x21) return 66;  // !
+    if (character == 0x3F) return 67;  // ?
+    if (character == 0xC3) return 68;  // Ã
+    if (character == 0xC2) return 69;  // Â
+    if (character == 0xC1) return 70;  // Á
+    if (character == 0xC0) return 71;  // À
+    if (character == 0xC9) return 72;  // É
+    if (character == 0xCA) return 73;  // Ê
+    if (character == 0xCD) return 74;  // Í
+    if (character == 0xD3) return 75;  // Ó
+    if (character == 0xD4) return 76;  // Ô
+    if (character == 0xD5) return 77;  // Õ
+    if (character == 0xDA) return 78;  // Ú
+    if (character == 0xC7) return 79;  // Ç
+    if (character == 0xE7) return 80;  // ç
+    if (character == 0xE3) return 81;  // ã
+    if (character == 0xE1) return 82;  // á
+    if (character == 0xE0) return 83;  // à
+    if (character == 0xE2) return 84;  // â
+    if (character == 0xE9) return 85;  // é
+    if (character == 0xEA) return 86;  // ê
+    if (character == 0xED) return 87;  // í
+    if (character == 0xF3) return 88;  // ó
+    if (character == 0xF4) return 89;  // ô
+    if (character == 0xFA) return 90;  // ú
+    if (character == 0x2C) return 91;  // ,
+    if (character == '-')  return 92;  // -
+    if (character == '+')  return 93;  // +
+    if (character == '/')  return 94;  // /
+
+    return 0; // caractere vazio/inválido
+}
+
+// Tabela Latin-1 → índice na fonte, montada uma vez a partir de ssd1306_get_font():
+// cada caractere desenhado custa um acesso em vez da cadeia de comparações.
+static uint8_t indice_glifo[256];
+static bool indice_pronto = false;
+
+static const uint8_t *glifo(uint8_t caractere) {
+    if (!indice_pronto) {
+        for (int c = 0; c < 256; c++) {
+            indice_glifo[c] = (uint8_t)ssd1306_get_font((uint8_t)c);
+        }
+        indice_pronto = true;
+    }
+    return &font[indice_glifo[caractere] * 8];
+}
+
+// ------------------------------------------------------------
+// Lê o próximo caractere de uma string UTF-8 como Latin-1.
+// Retorna false (e avança um byte) para sequências de 3+ bytes.
+// ------------------------------------------------------------
+static bool proximo_latin1(const char **utf8, uint8_t *latin1) {
+    uint8_t atual = (uint8_t)**utf8;
+
+    if ((atual & 0x80) == 0) {
+        // ASCII puro
+        *latin1 = atual;
+        (*utf8)++;
+        return true;
+    }
+    if ((atual & 0xE0) == 0xC0 && (*utf8)[1]) {
+        // UTF-8 de 2 bytes → Latin-1
+        uint8_t segundo = (uint8_t)(*utf8)[1];
+        *latin1 = ((atual & 0x1F) << 6) | (segundo & 0x3F);
+        *utf8 += 2;
+        return true;
+    }
+    // UTF-8 > 2 bytes (não suportado)
+    (*utf8)++;
+    return false;
+}
+
+// ------------------------------------------------------------
+// Copia um glifo para o quadro com o topo na linha 'y'. As 8 linhas
+// da célula são substituídas (fundo apagado), como no caso alinhado.
+// Não confere limites nem marca sujo: isso fica com quem chama.
+// ------------------------------------------------------------
+static void blit_glifo(ssd1306_dev_t *dev, int x, int y, const uint8_t *g) {
+    uint8_t *topo = dev->pixels + (y / 8) * dev->cfg.largura + x;
+    int deslocamento = y % 8;
+
+    if (deslocamento == 0) {
+        for (int i = 0; i < LARGURA_CARACTERE; i++) {
+            topo[i] = g[i];
+        }
+        return;
+    }
+
+    // Coluna deslocada: o byte baixo vai para a página de 'y', o alto para a
+    // seguinte (que existe, pois y <= altura - 8).
+    uint8_t *baixo = topo + dev->cfg.largura;
+    uint16_t mascara = (uint16_t)(0xFF << deslocamento);
+    uint8_t mascara_topo = (uint8_t)mascara;
+    uint8_t mascara_baixo = (uint8_t)(mascara >> 8);
+
+    for (int i = 0; i < LARGURA_CARACTERE; i++) {
+        uint16_t coluna = (uint16_t)(g[i] << deslocamento);
+        topo[i] = (topo[i] & ~mascara_topo) | (uint8_t)coluna;
+        baixo[i] = (baixo[i] & ~mascara_baixo) | (uint8_t)(coluna >> 8);
+    }
+}
+
+// Marca de uma vez os caracteres desenhados numa linha, de x_ini a x_fim (inclusive).
+static void marcar_linha(ssd1306_dev_t *dev, int x_ini, int x_fim, int y) {
+    if (x_fim < x_ini) return;
+    ssd1306_dev_marcar_sujo(dev, x_ini, y, x_fim + LARGURA_CARACTERE - 1, y + ALTURA_CARACTERE - 1);
+}
+
+// ------------------------------------------------------------
+// Desenha um caractere com o topo na linha 'y' (qualquer 'y')
+// ------------------------------------------------------------
+void ssd1306_dev_caractere(ssd1306_dev_t *dev, int16_t x, int16_t y, uint8_t caractere) {
+    if (x < 0 || y < 0) return;
+    if (x > dev->cfg.largura - LARGURA_CARACTERE || y > dev->cfg.altura - ALTURA_CARACTERE) return;
+
+    blit_glifo(dev, x, y, glifo(caractere));
+    ssd1306_dev_marcar_sujo(dev, x, y, x + LARGURA_CARACTERE - 1, y + ALTURA_CARACTERE - 1);
+}
+
+// ------------------------------------------------------------
+// String simples (ASCII puro) sem quebra de linha
+// ------------------------------------------------------------
+void ssd1306_dev_texto(ssd1306_dev_t *dev, int16_t x, int16_t y, const char *texto) {
+    const int max_x = dev->cfg.largura - LARGURA_CARACTERE;
+    if (x > max_x || y < 0 || y > dev->cfg.altura - ALTURA_CARACTERE) return;
+
+    int x_ini = -1, x_fim = -1;
+    for (int cx = x; *texto && cx <= max_x; cx += LARGURA_CARACTERE) {
+        uint8_t caractere = (uint8_t)*texto++;
+        if (cx < 0) continue;
+
+        blit_glifo(dev, cx, y, glifo(caractere));
+        if (x_ini < 0) x_ini = cx;
+        x_fim = cx;
+    }
+    marcar_linha(dev, x_ini, x_fim, y);
+}
+
+// ------------------------------------------------------------
+// String UTF-8 (acentos Latin-1) numa única linha
+// ------------------------------------------------------------
+void ssd1306_dev_texto_utf8(ssd1306_dev_t *dev, int16_t x, int16_t y, const char *utf8) {
+    const int max_x = dev->cfg.largura - LARGURA_CARACTERE;
+    if (x > max_x || y < 0 || y > dev->cfg.altura - ALTURA_CARACTERE) return;
+
+    int x_ini = -1, x_fim = -1;
+    int cx = x;
+    uint8_t latin1;
+    while (*utf8 && cx <= max_x) {
+        if (proximo_latin1(&utf8, &latin1)) {
+            if (cx >= 0) {
+                blit_glifo(dev, cx, y, glifo(latin1));
+                if (x_ini < 0) x_ini = cx;
+                x_fim = cx;
+            }
+            cx += LARGURA_CARACTERE;
+        }
+    }
+    marcar_linha(dev, x_ini, x_fim, y);
+}
+
+// ----------------------------------------------------------------------
+// String UTF-8 com quebra automática de linha ao atingir a borda direita
+// ----------------------------------------------------------------------
+void ssd1306_dev_texto_utf8_multilinha(ssd1306_dev_t *dev, int16_t x, int16_t y, const char *utf8) {
+    const int max_x = dev->cfg.largura - LARGURA_CARACTERE;
+    const int max_y = dev->cfg.altura - ALTURA_CARACTERE;
+
+    int x_ini = -1, x_fim = -1;
+    int cx = x, cy = y;
+    uint8_t latin1;
+    while (*utf8 && cy <= max_y) {
+        if (proximo_latin1(&utf8, &latin1)) {
+            if (cx >= 0 && cy >= 0 && cx <= max_x) {
+                blit_glifo(dev, cx, cy, glifo(latin1));
+                if (x_ini < 0) x_ini = cx;
+                x_fim = cx;
+            }
+            cx += LARGURA_CARACTERE;
+
+            if (cx > max_x) {
+                if (cy >= 0) marcar_linha(dev, x_ini, x_fim, cy);
+                x_ini = x_fim = -1;
+                cx = 0;
+                cy += ALTURA_CARACTERE;
+            }
+        }
+    }
+    if (cy >= 0 && cy <= max_y) marcar_linha(dev, x_ini, x_fim, cy);
+}
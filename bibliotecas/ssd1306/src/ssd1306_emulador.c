@@ -0,0 +1,259 @@
+/**
+ * ssd1306_emulador.c
+ *
+ * Decodificador dos bytes do barramento como o controlador faz: cada sessão
+ * começa com um byte de controle, os comandos acumulam os seus parâmetros e
+ * os dados entram na RAM no ponteiro de escrita do modo de endereçamento.
+ */
+
+#include "ssd1306_emulador.h"
+#include <string.h>
+
+// Byte de controle: Co (0x80) = só o próximo byte, D/C# (0x40) = dados.
+#define CONTROLE_CO 0x80
+#define CONTROLE_DADOS 0x40
+
+enum {
+    ESPERA_CONTROLE = 0,
+    COMANDOS,
+    DADOS,
+    UM_COMANDO,
+    UM_DADO,
+};
+
+// Quadros por passo de rolagem, pelo código de intervalo do datasheet.
+static const uint16_t quadros_por_passo[8] = { 5, 64, 128, 256, 3, 4, 25, 2 };
+
+static uint8_t parametros(uint8_t comando) {
+    switch (comando) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8:
+        case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+void ssd1306_emulador_zerar_contadores(ssd1306_emulador_t *emu) {
+    emu->bytes = 0;
+    emu->transacoes = 0;
+    emu->comandos = 0;
+    emu->dados = 0;
+    emu->escritas_rolando = 0;
+    emu->erros = 0;
+    emu->bits = 0;
+}
+
+// --------------------------------------------------------------
+// Valores de reset do datasheet: endereçamento por página, display
+// desligado e sem remapeamentos. A RAM começa apagada
+// --------------------------------------------------------------
+void ssd1306_emulador_iniciar(ssd1306_emulador_t *emu, uint8_t largura, uint8_t altura,
+                              uint32_t frequencia_hz) {
+    memset(emu, 0, sizeof(*emu));
+    emu->endereco = 0x3C;
+    emu->largura = largura > SSD1306_LARGURA_MAX ? SSD1306_LARGURA_MAX : largura;
+    emu->altura = altura > SSD1306_ALTURA_MAX ? SSD1306_ALTURA_MAX : altura;
+
+    emu->modo = SSD1306_EMULADOR_PAGINA;
+    emu->col_fim = SSD1306_LARGURA_MAX - 1;
+    emu->pag_fim = SSD1306_PAGINAS_MAX - 1;
+    emu->multiplex = SSD1306_ALTURA_MAX - 1;
+    emu->contraste = 0x7F;
+    emu->rolagem_quadros = quadros_por_passo[0];
+    emu->frequencia_hz = frequencia_hz;
+}
+
+static void executar(ssd1306_emulador_t *emu) {
+    const uint8_t *c = emu->comando;
+    emu->comandos++;
+
+    if (c[0] <= 0x0F) {                     // Coluna, nibble baixo (modo página)
+        emu->coluna = (emu->coluna & 0xF0) | (c[0] & 0x0F);
+    } else if (c[0] <= 0x1F) {              // Coluna, nibble alto (modo página)
+        emu->coluna = (uint8_t)(((c[0] & 0x07) << 4) | (emu->coluna & 0x0F));
+    } else if (c[0] >= 0x40 && c[0] <= 0x7F) {
+        emu->linha_inicial = c[0] & 0x3F;
+    } else if (c[0] >= 0xB0 && c[0] <= 0xB7) {
+        emu->pagina = c[0] & 0x07;
+    } else {
+        switch (c[0]) {
+            case 0x20:
+                if ((c[1] & 0x03) == 0x03) emu->erros++;
+                else emu->modo = (ssd1306_emulador_modo_t)(c[1] & 0x03);
+                break;
+            case 0x21:
+                emu->col_ini = c[1] & 0x7F;
+                emu->col_fim = c[2] & 0x7F;
+                emu->coluna = emu->col_ini;
+                break;
+            case 0x22:
+                emu->pag_ini = c[1] & 0x07;
+                emu->pag_fim = c[2] & 0x07;
+                emu->pagina = emu->pag_ini;
+                break;
+            case 0x26: case 0x27:
+                emu->rolando = false;       // Configurar exige a rolagem parada
+                emu->rolagem_esquerda = c[0] == 0x27;
+                emu->rolagem_pag_ini = c[2] & 0x07;
+                emu->rolagem_quadros = quadros_por_passo[c[3] & 0x07];
+                emu->rolagem_pag_fim = c[4] & 0x07;
+                emu->quadros_contados = 0;
+                break;
+            case 0x2E: emu->rolando = false; break;
+            case 0x2F: emu->rolando = true; break;
+            case 0x81: emu->contraste = c[1]; break;
+            case 0xA0: case 0xA1: emu->segmentos_remapeados = c[0] & 0x01; break;
+            case 0xA4: case 0xA5: emu->tudo_aceso = c[0] & 0x01; break;
+            case 0xA6: case 0xA7: emu->invertido = c[0] & 0x01; break;
+            case 0xA8: emu->multiplex = c[1] & 0x3F; break;
+            case 0xAE: case 0xAF: emu->ligado = c[0] & 0x01; break;
+            case 0xC0: case 0xC8: emu->com_remapeado = c[0] & 0x08; break;
+            case 0xD3: emu->deslocamento = c[1] & 0x3F; break;
+            default: break;                 // Temporização, alimentação, rolagem vertical, NOP
+        }
+    }
+}
+
+static void comando(ssd1306_emulador_t *emu, uint8_t byte) {
+    if (emu->esperados == 0) {
+        emu->esperados = 1 + parametros(byte);
+        emu->recebidos = 0;
+    }
+    emu->comando[emu->recebidos++] = byte;
+    if (emu->recebidos == emu->esperados) {
+        executar(emu);
+        emu->esperados = 0;
+    }
+}
+
+// --------------------------------------------------------------
+// Grava um byte na RAM e avança o ponteiro como o modo manda:
+// horizontal e vertical dão a volta na janela, página só na coluna
+// --------------------------------------------------------------
+static void dado(ssd1306_emulador_t *emu, uint8_t byte) {
+    emu->ram[emu->pagina][emu->coluna] = byte;
+    emu->dados++;
+    if (emu->rolando) emu->escritas_rolando++;
+
+    switch (emu->modo) {
+        case SSD1306_EMULADOR_HORIZONTAL:
+            if (emu->coluna++ >= emu->col_fim) {
+                emu->coluna = emu->col_ini;
+                emu->pagina = emu->pagina >= emu->pag_fim ? emu->pag_ini : emu->pagina + 1;
+            }
+            break;
+        case SSD1306_EMULADOR_VERTICAL:
+            if (emu->pagina++ >= emu->pag_fim) {
+                emu->pagina = emu->pag_ini;
+                emu->coluna = emu->coluna >= emu->col_fim ? emu->col_ini : emu->coluna + 1;
+            }
+            break;
+        default:
+            emu->coluna = (emu->coluna + 1) % SSD1306_LARGURA_MAX;
+            break;
+    }
+}
+
+// Uma escrita é uma sessão (START ou RESTART) e começa por um byte de controle.
+static void escrever_emulador(void *porta, uint8_t endereco, const uint8_t *bytes,
+                              size_t tamanho, bool sem_stop) {
+    ssd1306_emulador_t *emu = porta;
+
+    emu->bits += 1 + 9 + 9 * (uint64_t)tamanho + (sem_stop ? 0 : 1);
+    emu->bytes += tamanho;
+    if (!sem_stop) emu->transacoes++;
+
+    if (endereco != emu->endereco) {
+        emu->erros++;
+        return;
+    }
+
+    emu->estado = ESPERA_CONTROLE;
+    for (size_t i = 0; i < tamanho; i++) {
+        uint8_t byte = bytes[i];
+
+        switch (emu->estado) {
+            case ESPERA_CONTROLE:
+                if (byte & 0x3F) {
+                    emu->erros++;
+                    return;
+                }
+                if (byte & CONTROLE_CO) emu->estado = (byte & CONTROLE_DADOS) ? UM_DADO : UM_COMANDO;
+                else emu->estado = (byte & CONTROLE_DADOS) ? DADOS : COMANDOS;
+                break;
+            case COMANDOS:
+                comando(emu, byte);
+                break;
+            case DADOS:
+                dado(emu, byte);
+                break;
+            case UM_COMANDO:
+                comando(emu, byte);
+                emu->estado = ESPERA_CONTROLE;
+                break;
+            case UM_DADO:
+                dado(emu, byte);
+                emu->estado = ESPERA_CONTROLE;
+                break;
+        }
+    }
+}
+
+ssd1306_barramento_t ssd1306_barramento_emulador(ssd1306_emulador_t *emu) {
+    return (ssd1306_barramento_t){ .escrever = escrever_emulador, .porta = emu };
+}
+
+// --------------------------------------------------------------
+// A linha de COM y mostra a linha de RAM (y + linha inicial), ao
+// contrário sem o remapeamento de COM; sem o de segmentos, a coluna
+// é espelhada. Os módulos são montados para 0xA1/0xC8 ficar de pé
+// --------------------------------------------------------------
+bool ssd1306_emulador_pixel(const ssd1306_emulador_t *emu, int x, int y) {
+    if (x < 0 || x >= emu->largura || y < 0 || y >= emu->altura) return false;
+    if (!emu->ligado) return false;
+    if (emu->tudo_aceso) return true;
+
+    int com = emu->com_remapeado ? y : emu->multiplex - y;
+    int linha = (com + emu->linha_inicial + emu->deslocamento) & (SSD1306_ALTURA_MAX - 1);
+    int coluna = emu->segmentos_remapeados ? x : emu->largura - 1 - x;
+
+    bool aceso = (emu->ram[linha / 8][coluna] >> (linha % 8)) & 1;
+    return aceso != emu->invertido;
+}
+
+// Um passo de rolagem gira as páginas da faixa em uma coluna.
+static void passo_rolagem(ssd1306_emulador_t *emu) {
+    for (int p = emu->rolagem_pag_ini; p <= emu->rolagem_pag_fim; p++) {
+        uint8_t *linha = emu->ram[p];
+        if (emu->rolagem_esquerda) {
+            uint8_t primeira = linha[0];
+            memmove(linha, linha + 1, SSD1306_LARGURA_MAX - 1);
+            linha[SSD1306_LARGURA_MAX - 1] = primeira;
+        } else {
+            uint8_t ultima = linha[SSD1306_LARGURA_MAX - 1];
+            memmove(linha + 1, linha, SSD1306_LARGURA_MAX - 1);
+            linha[0] = ultima;
+        }
+    }
+}
+
+void ssd1306_emulador_quadros(ssd1306_emulador_t *emu, uint32_t quadros) {
+    while (emu->rolando && quadros--) {
+        if (++emu->quadros_contados >= emu->rolagem_quadros) {
+            emu->quadros_contados = 0;
+            passo_rolagem(emu);
+        }
+    }
+}
+
+uint32_t ssd1306_emulador_tempo_us(const ssd1306_emulador_t *emu) {
+    if (emu->frequencia_hz == 0) return 0;
+    return (uint32_t)(emu->bits * 1000000u / emu->frequencia_hz);
+}
@@ -0,0 +1,103 @@
+/**
+ * ssd1306_grande.c
+ *
+ * Dígitos e símbolos grandes alinhados às páginas: cada coluna do glifo é
+ * copiada byte a byte para o quadro, e o número grande só redesenha as
+ * posições que mudaram desde a última atualização.
+ */
+
+#include "ssd1306_grande.h"
+#include "ssd1306_sem_heap.h"
+
+// Intervalo de colunas e páginas do glifo que cabe no quadro (vazio se c0 > c1).
+static void recortar(const ssd1306_dev_t *dev, int x, uint8_t pagina, const ssd1306_glifo_grande_t *glifo,
+                     int *c0, int *c1, int *paginas) {
+    *c0 = x < 0 ? -x : 0;
+    *c1 = glifo->largura - 1;
+    if (x + *c1 > dev->cfg.largura - 1) *c1 = dev->cfg.largura - 1 - x;
+
+    *paginas = glifo->paginas;
+    if (pagina + *paginas > dev->paginas) *paginas = dev->paginas - pagina;
+    if (*paginas <= 0) *c1 = *c0 - 1;
+}
+
+// --------------------------------------------------------------
+// Copia o glifo para o quadro, coluna a coluna
+// --------------------------------------------------------------
+void ssd1306_dev_glifo_grande(ssd1306_dev_t *dev, int x, uint8_t pagina, const ssd1306_glifo_grande_t *glifo) {
+    int c0, c1, paginas;
+    recortar(dev, x, pagina, glifo, &c0, &c1, &paginas);
+    if (c0 > c1) return;
+
+    for (int p = 0; p < paginas; p++) {
+        uint8_t *destino = dev->pixels + (pagina + p) * dev->cfg.largura + x;
+        const uint8_t *origem = glifo->colunas + p;
+        for (int c = c0; c <= c1; c++) {
+            destino[c] = origem[c * glifo->passo];
+        }
+    }
+    ssd1306_dev_marcar_sujo(dev, x + c0, pagina * 8, x + c1, (pagina + paginas) * 8 - 1);
+}
+
+// Apaga o retângulo ocupado por um glifo exibido antes.
+static void apagar_glifo(ssd1306_dev_t *dev, int x, uint8_t pagina, const ssd1306_glifo_grande_t *glifo) {
+    int c0, c1, paginas;
+    recortar(dev, x, pagina, glifo, &c0, &c1, &paginas);
+    if (c0 > c1) return;
+
+    for (int p = 0; p < paginas; p++) {
+        uint8_t *destino = dev->pixels + (pagina + p) * dev->cfg.largura + x;
+        for (int c = c0; c <= c1; c++) {
+            destino[c] = 0;
+        }
+    }
+    ssd1306_dev_marcar_sujo(dev, x + c0, pagina * 8, x + c1, (pagina + paginas) * 8 - 1);
+}
+
+// Verdadeiro se a lista tem o mesmo glifo na mesma coluna.
+static bool na_lista(const int16_t *x, const ssd1306_glifo_grande_t *const *glifos, int quantidade,
+                     int16_t x_procurado, const ssd1306_glifo_grande_t *glifo) {
+    for (int i = 0; i < quantidade; i++) {
+        if (x[i] == x_procurado && glifos[i] == glifo) return true;
+    }
+    return false;
+}
+
+void ssd1306_grande_iniciar(ssd1306_grande_t *grande, ssd1306_dev_t *dev, uint8_t pagina) {
+    grande->dev = dev;
+    grande->pagina = pagina;
+    grande->quantidade = 0;
+}
+
+// --------------------------------------------------------------
+// Exibe 'quantidade' glifos nas colunas x[] (glifo NULL = posição
+// vazia). Primeiro apaga as posições antigas que não continuam,
+// depois desenha só as novas; as que não mudaram ficam intactas.
+// --------------------------------------------------------------
+void ssd1306_grande_exibir(ssd1306_grande_t *grande, const int16_t *x,
+                           const ssd1306_glifo_grande_t *const *glifos, int quantidade) {
+    if (quantidade > SSD1306_GRANDE_MAX) quantidade = SSD1306_GRANDE_MAX;
+
+    for (int i = 0; i < grande->quantidade; i++) {
+        if (grande->glifo[i] && !na_lista(x, glifos, quantidade, grande->x[i], grande->glifo[i])) {
+            apagar_glifo(grande->dev, grande->x[i], grande->pagina, grande->glifo[i]);
+        }
+    }
+
+    for (int i = 0; i < quantidade; i++) {
+        if (glifos[i] && !na_lista(grande->x, grande->glifo, grande->quantidade, x[i], glifos[i])) {
+            ssd1306_dev_glifo_grande(grande->dev, x[i], grande->pagina, glifos[i]);
+        }
+    }
+
+    for (int i = 0; i < quantidade; i++) {
+        grande->x[i] = x[i];
+        grande->glifo[i] = glifos[i];
+    }
+    grande->quantidade = quantidade;
+}
+
+// Depois que o quadro foi apagado por fora: a próxima atualização desenha tudo.
+void ssd1306_grande_esquecer(ssd1306_grande_t *grande) {
+    grande->quantidade = 0;
+}
@@ -0,0 +1,11 @@
+#include "ssd1306_graphics.h"
+#include "ssd1306_init.h"
+#include "ssd1306_sem_heap.h"
+
+void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
+    ssd1306_dev_pixel(ssd1306_padrao_quadro(ssd), x, y, set);
+}
+
+void ssd1306_draw_line(uint8_t *ssd, int x0, int y0, int x1, int y1, bool set) {
+    ssd1306_dev_linha(ssd1306_padrao_quadro(ssd), x0, y0, x1, y1, set);
+}
@@ -0,0 +1,155 @@
+#include "ssd1306_init.h"
+#include "ssd1306_barramento_i2c.h"
+#include <string.h>
+#include "ssd1306_sem_heap.h"
+
+// Instância usada pela API global (um display 128x64 por projeto).
+static ssd1306_dev_t padrao;
+static bool padrao_criado = false;
+
+static void criar_padrao(i2c_inst_t *i2c, uint8_t endereco) {
+    ssd1306_config_t cfg = {
+        .barramento = ssd1306_barramento_i2c(i2c),
+        .endereco = endereco,
+        .largura = ssd1306_width,
+        .altura = ssd1306_height,
+        .rotacao = SSD1306_ROTACAO_0,
+        .vcc_externo = false,
+    };
+    uint8_t *pixels = padrao.pixels;
+
+    ssd1306_dev_criar(&padrao, &cfg, NULL);
+    padrao.pixels = pixels;
+    padrao_criado = true;
+}
+
+ssd1306_dev_t *ssd1306_padrao(void) {
+    if (!padrao_criado) criar_padrao(i2c1, ssd1306_i2c_address);
+    return &padrao;
+}
+
+// A instância padrão desenhando no buffer recebido pela API global.
+ssd1306_dev_t *ssd1306_padrao_quadro(uint8_t *buffer) {
+    ssd1306_dev_t *dev = ssd1306_padrao();
+    dev->pixels = buffer;
+    return dev;
+}
+
+// Total de bytes escritos no barramento e de sessões START..STOP, para medir o
+// custo de cada atualização.
+uint32_t ssd1306_bytes_enviados(void) {
+    return ssd1306_padrao()->bytes_enviados;
+}
+
+uint32_t ssd1306_transacoes(void) {
+    return ssd1306_padrao()->transacoes;
+}
+
+void ssd1306_send_command(uint8_t command) {
+    ssd1306_dev_comandos(ssd1306_padrao(), &command, 1);
+}
+
+void ssd1306_fluxo_enviar(ssd1306_fluxo_t *fluxo, uint8_t *dados, int tamanho) {
+    ssd1306_dev_fluxo_enviar(ssd1306_padrao(), fluxo, dados, tamanho);
+}
+
+// Lista inteira numa transação (em blocos de SSD1306_FLUXO_MAX, se for maior).
+void ssd1306_send_command_list(uint8_t *cmd_list, int number) {
+    ssd1306_dev_comandos(ssd1306_padrao(), cmd_list, number);
+}
+
+// 'buffer' deve apontar para dentro de ssd1306_framebuffer_t.pixels (ver ssd1306_dev_enviar_dados).
+void ssd1306_send_buffer(uint8_t *buffer, int length) {
+    ssd1306_dev_enviar_dados(ssd1306_padrao(), buffer, length);
+}
+
+void ssd1306_init(void) {
+    ssd1306_dev_init(ssd1306_padrao());
+}
+
+// Inicializa o display padrão numa porta/endereço que não sejam i2c1/0x3C.
+void ssd1306_init_i2c(i2c_inst_t *i2c, uint8_t endereco) {
+    criar_padrao(i2c, endereco);
+    ssd1306_dev_init(&padrao);
+}
+
+// Cria a lista de comandos para configurar o scrolling
+void ssd1306_scroll(bool set) {
+    uint8_t commands[] = {
+        ssd1306_set_horizontal_scroll | 0x00, 0x00, 0x00, 0x00, 0x03,
+        0x00, 0xFF, ssd1306_set_scroll | (set ? 0x01 : 0)
+    };
+
+    ssd1306_send_command_list(commands, count_of(commands));
+}
+
+void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
+    ssd->port_buffer[1] = command;
+    i2c_write_blocking(ssd->i2c_port, ssd->address, ssd->port_buffer, 2, false);
+}
+
+// Envia o fluxo numa transação do modo bitmap. Com 'sem_stop', o barramento fica
+// com o mestre e os dados que seguem saem na mesma sessão, após um RESTART.
+static void enviar_fluxo_bm(ssd1306_t *ssd, ssd1306_fluxo_t *fluxo, bool sem_stop) {
+    i2c_write_blocking(ssd->i2c_port, ssd->address, fluxo->bytes, fluxo->tamanho + 1, sem_stop);
+    ssd1306_fluxo_iniciar(fluxo);
+}
+
+// Sequência de inicialização num fluxo só: um controle 0x00 e 25 comandos numa
+// transação, no lugar de 25 transações de 2 bytes.
+void ssd1306_config(ssd1306_t *ssd) {
+    static const uint8_t cmds[] = {
+        ssd1306_set_display | 0x00,
+        ssd1306_set_memory_mode, 0x01,
+        ssd1306_set_display_start_line | 0x00,
+        ssd1306_set_segment_remap | 0x01,
+        ssd1306_set_mux_ratio, ssd1306_height - 1,
+        ssd1306_set_common_output_direction | 0x08,
+        ssd1306_set_display_offset, 0x00,
+        ssd1306_set_common_pin_configuration, 0x12,
+        ssd1306_set_display_clock_divide_ratio, 0x80,
+        ssd1306_set_precharge, 0xF1,
+        ssd1306_set_vcomh_deselect_level, 0x30,
+        ssd1306_set_contrast, 0xFF,
+        ssd1306_set_entire_on,
+        ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, 0x14,
+        ssd1306_set_display | 0x01,
+    };
+    ssd1306_fluxo_t fluxo;
+    ssd1306_fluxo_iniciar(&fluxo);
+
+    for (uint i = 0; i < count_of(cmds); i++) {
+        ssd1306_fluxo_adicionar(&fluxo, cmds[i]);
+    }
+    enviar_fluxo_bm(ssd, &fluxo, false);
+}
+
+// O buffer vem de quem chama (SSD1306_BM_TAMANHO bytes: o controle 0x40 e os pixels),
+// então cada display em modo bitmap tem o seu e o módulo continua livre de heap.
+bool ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address,
+                     i2c_inst_t *i2c, uint8_t *ram_buffer, size_t tamanho) {
+    if (!ram_buffer || tamanho < SSD1306_BM_TAMANHO(width, height)) return false;
+
+    ssd->width = width;
+    ssd->height = height;
+    ssd->pages = height / 8;
+    ssd->address = address;
+    ssd->i2c_port = i2c;
+    ssd->external_vcc = external_vcc;
+    ssd->bufsize = SSD1306_BM_TAMANHO(width, height);
+    ssd->ram_buffer = ram_buffer;
+    memset(ram_buffer, 0, ssd->bufsize);
+    ssd->ram_buffer[0] = 0x40;
+    ssd->port_buffer[0] = 0x80;
+    return true;
+}
+
+// Janela do quadro inteiro e dados na mesma sessão: comandos, RESTART, 0x40 e pixels.
+void ssd1306_send_data(ssd1306_t *ssd) {
+    ssd1306_fluxo_t fluxo;
+    ssd1306_fluxo_iniciar(&fluxo);
+    ssd1306_fluxo_janela(&fluxo, 0, ssd->width - 1, 0, ssd->pages - 1);
+    enviar_fluxo_bm(ssd, &fluxo, true);
+    i2c_write_blocking(ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize, false);
+}
@@ -0,0 +1,43 @@
+#include "ssd1306_pbm.h"
+#include <stdio.h>
+
+typedef bool (*ler_pixel_t)(const void *origem, int x, int y);
+
+// Cada linha do PBM tem (largura + 7) / 8 bytes, bit 7 = pixel mais à esquerda.
+static bool gravar(const char *caminho, int largura, int altura, ler_pixel_t ler, const void *origem) {
+    FILE *arquivo = fopen(caminho, "wb");
+    if (!arquivo) return false;
+
+    fprintf(arquivo, "P4\n%d %d\n", largura, altura);
+
+    uint8_t linha[(SSD1306_LARGURA_MAX + 7) / 8];
+    int bytes = (largura + 7) / 8;
+    for (int y = 0; y < altura; y++) {
+        for (int b = 0; b < bytes; b++) linha[b] = 0;
+
+        for (int x = 0; x < largura; x++) {
+            if (ler(origem, x, y)) {
+                linha[x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+        fwrite(linha, 1, bytes, arquivo);
+    }
+    return fclose(arquivo) == 0;
+}
+
+static bool pixel_quadro(const void *origem, int x, int y) {
+    const ssd1306_dev_t *dev = origem;
+    return dev->pixels[(y / 8) * dev->cfg.largura + x] & (1u << (y % 8));
+}
+
+static bool pixel_painel(const void *origem, int x, int y) {
+    return ssd1306_emulador_pixel(origem, x, y);
+}
+
+bool ssd1306_dev_salvar_pbm(const ssd1306_dev_t *dev, const char *caminho) {
+    return gravar(caminho, dev->cfg.largura, dev->cfg.altura, pixel_quadro, dev);
+}
+
+bool ssd1306_emulador_salvar_pbm(const ssd1306_emulador_t *emu, const char *caminho) {
+    return gravar(caminho, emu->largura, emu->altura, pixel_painel, emu);
+}
@@ -0,0 +1,168 @@
+/**
+ * ssd1306_rolagem.c
+ *
+ * Log com rolagem pela linha inicial, letreiro com a rolagem horizontal do
+ * controlador e gráfico de varredura escrito coluna a coluna.
+ */
+
+#include "ssd1306_rolagem.h"
+#include "ssd1306_sem_heap.h"
+
+static void linha_inicial(ssd1306_dev_t *dev, uint8_t linha) {
+    uint8_t comando = ssd1306_set_display_start_line | (linha & 0x3F);
+    ssd1306_dev_comandos(dev, &comando, 1);
+}
+
+// --------------------------------------------------------------
+// Apaga a tela e volta a linha inicial para 0. Só para displays
+// de 64 linhas: a linha inicial dá a volta nas 64 linhas da RAM
+// --------------------------------------------------------------
+bool ssd1306_log_iniciar(ssd1306_log_t *log, ssd1306_dev_t *dev) {
+    if (dev->cfg.altura != SSD1306_ALTURA_MAX) return false;
+
+    log->dev = dev;
+    log->topo = 0;
+    log->linhas = 0;
+
+    ssd1306_dev_limpar(dev);
+    ssd1306_dev_flush(dev);
+    linha_inicial(dev, 0);
+    return true;
+}
+
+// --------------------------------------------------------------
+// Até a tela encher, as linhas descem página a página. Depois, a
+// página do topo recebe a linha nova e passa para baixo
+// --------------------------------------------------------------
+void ssd1306_log_adicionar(ssd1306_log_t *log, const char *utf8) {
+    ssd1306_dev_t *dev = log->dev;
+    bool rolar = log->linhas >= dev->paginas;
+    uint8_t pagina = rolar ? log->topo : log->linhas++;
+
+    // Só a página da linha nova vai ao barramento (as faixas que mudaram)
+    ssd1306_dev_limpar_paginas(dev, pagina, pagina);
+    ssd1306_dev_texto_utf8(dev, 0, pagina * 8, utf8);
+    ssd1306_dev_flush(dev);
+
+    if (rolar) {
+        log->topo = (log->topo + 1) % dev->paginas;
+        linha_inicial(dev, log->topo * 8);
+    }
+}
+
+// Volta à linha inicial 0 com a tela apagada, para o desenho normal.
+void ssd1306_log_encerrar(ssd1306_log_t *log) {
+    ssd1306_dev_limpar(log->dev);
+    ssd1306_dev_flush(log->dev);
+    linha_inicial(log->dev, 0);
+    log->topo = 0;
+    log->linhas = 0;
+}
+
+// Com a rolagem ativa o controlador reescreve as páginas sozinho.
+void ssd1306_dev_rolagem_horizontal(ssd1306_dev_t *dev, uint8_t pagina_ini, uint8_t pagina_fim,
+                                    bool para_esquerda, uint8_t intervalo) {
+    uint8_t cmds[] = {
+        ssd1306_set_scroll | 0x00,                                  // Para a anterior
+        ssd1306_set_horizontal_scroll | (para_esquerda ? 0x01 : 0x00),
+        0x00,
+        pagina_ini & 0x07,
+        intervalo & 0x07,
+        pagina_fim & 0x07,
+        0x00,
+        0xFF,
+        ssd1306_set_scroll | 0x01,
+    };
+    ssd1306_dev_comandos(dev, cmds, sizeof(cmds));
+}
+
+// O conteúdo deslocado na RAM não volta sozinho: o quadro inteiro fica sujo.
+void ssd1306_dev_parar_rolagem(ssd1306_dev_t *dev) {
+    uint8_t comando = ssd1306_set_scroll | 0x00;
+    ssd1306_dev_comandos(dev, &comando, 1);
+    ssd1306_dev_marcar_tudo_sujo(dev);
+}
+
+void ssd1306_grafico_iniciar(ssd1306_grafico_t *grafico, ssd1306_dev_t *dev, int16_t x, uint8_t largura,
+                             uint8_t pagina_ini, uint8_t paginas, float minimo, float maximo) {
+    if (x < 0) x = 0;
+    if (x + largura > dev->cfg.largura) largura = dev->cfg.largura - x;
+    if (pagina_ini + paginas > dev->paginas) paginas = dev->paginas - pagina_ini;
+
+    grafico->dev = dev;
+    grafico->x = x;
+    grafico->largura = largura;
+    grafico->pagina_ini = pagina_ini;
+    grafico->paginas = paginas;
+    grafico->minimo = minimo;
+    grafico->maximo = maximo;
+    grafico->cursor = 0;
+    grafico->ultimo_y = -1;
+}
+
+// --------------------------------------------------------------
+// Envia as colunas c0..c1 do gráfico numa só sessão (janela +
+// dados). O endereçamento continua horizontal, o do resto do
+// driver: os bytes seguem página a página, c0..c1 em cada uma
+// --------------------------------------------------------------
+static void enviar_colunas(ssd1306_grafico_t *grafico, int c0, int c1) {
+    ssd1306_dev_t *dev = grafico->dev;
+    uint8_t dados[1 + 2 * SSD1306_PAGINAS_MAX];    // dados[0]: controle 0x40
+    int tamanho = 0;
+
+    for (int p = 0; p < grafico->paginas; p++) {
+        const uint8_t *linha = dev->pixels + (grafico->pagina_ini + p) * dev->cfg.largura + grafico->x;
+        for (int c = c0; c <= c1; c++) {
+            dados[1 + tamanho++] = linha[c];
+        }
+    }
+
+    ssd1306_fluxo_t fluxo;
+    ssd1306_fluxo_iniciar(&fluxo);
+    ssd1306_fluxo_janela(&fluxo, grafico->x + c0, grafico->x + c1,
+                         grafico->pagina_ini, grafico->pagina_ini + grafico->paginas - 1);
+    ssd1306_dev_fluxo_enviar(dev, &fluxo, dados + 1, tamanho);
+}
+
+// --------------------------------------------------------------
+// Desenha a amostra na coluna do cursor (ligada à anterior por um
+// traço vertical), apaga a coluna seguinte e envia as duas
+// --------------------------------------------------------------
+void ssd1306_grafico_adicionar(ssd1306_grafico_t *grafico, float valor) {
+    if (grafico->largura == 0 || grafico->paginas == 0) return;
+
+    ssd1306_dev_t *dev = grafico->dev;
+    const int altura = grafico->paginas * 8;
+
+    if (valor < grafico->minimo) valor = grafico->minimo;
+    if (valor > grafico->maximo) valor = grafico->maximo;
+    int y = (int)((grafico->maximo - valor) * (altura - 1) / (grafico->maximo - grafico->minimo) + 0.5f);
+
+    int y0 = y, y1 = y;
+    if (grafico->ultimo_y >= 0) {
+        if (grafico->ultimo_y < y0) y0 = grafico->ultimo_y;
+        if (grafico->ultimo_y > y1) y1 = grafico->ultimo_y;
+    }
+    grafico->ultimo_y = y;
+
+    int coluna = grafico->cursor;
+    int vazia = (coluna + 1) % grafico->largura;
+    for (int p = 0; p < grafico->paginas; p++) {
+        uint8_t *linha = dev->pixels + (grafico->pagina_ini + p) * dev->cfg.largura + grafico->x;
+        uint8_t byte = 0;
+        for (int bit = 0; bit < 8; bit++) {
+            int linha_px = p * 8 + bit;
+            if (linha_px >= y0 && linha_px <= y1) byte |= 1 << bit;
+        }
+        linha[coluna] = byte;
+        if (vazia != coluna) linha[vazia] = 0;
+    }
+
+    if (vazia == coluna + 1) {
+        enviar_colunas(grafico, coluna, vazia);
+    } else {
+        enviar_colunas(grafico, coluna, coluna);
+        if (vazia != coluna) enviar_colunas(grafico, vazia, vazia);
+    }
+    grafico->cursor = vazia;
+}
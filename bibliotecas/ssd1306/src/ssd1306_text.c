@@ -0,0 +1,31 @@
+/**
+ * ssd1306_text.c
+ * 
+ * Módulo de texto para o display OLED SSD1306 usando o barramento I2C.
+ * API global sobre a instância padrão; o desenho fica em ssd1306_dev_texto.c.
+ * 
+ * Funções principais:
+ * - ssd1306_draw_char(): desenha um único caractere no buffer.
+ * - ssd1306_draw_string(): desenha uma string simples (ASCII).
+ * - ssd1306_draw_utf8_string(): desenha string UTF-8 com acentuação numa linha.
+ * - ssd1306_draw_utf8_multiline(): desenha string UTF-8 com acentuação e quebra de linha.
+ */
+
+#include "ssd1306_text.h"
+#include "ssd1306_sem_heap.h"
+
+void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
+    ssd1306_dev_caractere(ssd1306_padrao_quadro(ssd), x, y, character);
+}
+
+void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, const char *string) {
+    ssd1306_dev_texto(ssd1306_padrao_quadro(ssd), x, y, string);
+}
+
+void ssd1306_draw_utf8_string(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string) {
+    ssd1306_dev_texto_utf8(ssd1306_padrao_quadro(ssd), x, y, utf8_string);
+}
+
+void ssd1306_draw_utf8_multiline(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string) {
+    ssd1306_dev_texto_utf8_multilinha(ssd1306_padrao_quadro(ssd), x, y, utf8_string);
+}
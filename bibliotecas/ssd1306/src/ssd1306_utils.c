@@ -0,0 +1,92 @@
+#include "ssd1306_utils.h"
+#include "ssd1306_init.h"  // <- ESSENCIAL para declarar corretamente as funções usadas
+#include <string.h>
+#include "ssd1306_sem_heap.h"
+
+void calculate_render_area_buffer_length(struct render_area *area) {
+    area->buffer_length = (area->end_column - area->start_column + 1) *
+                          (area->end_page - area->start_page + 1);
+}
+
+void render_on_display(uint8_t *buffer, struct render_area *area) {
+    ssd1306_dev_t *dev = ssd1306_padrao();
+
+    // Janela e quadro na mesma sessão I2C.
+    ssd1306_fluxo_t fluxo;
+    ssd1306_fluxo_iniciar(&fluxo);
+    ssd1306_fluxo_janela(&fluxo, area->start_column, area->end_column, area->start_page, area->end_page);
+    ssd1306_dev_fluxo_enviar(dev, &fluxo, buffer, area->buffer_length);
+
+    // Uma área de largura total deixa as suas páginas em dia com o display.
+    if (area->start_column == 0 && area->end_column == ssd1306_width - 1) {
+        ssd1306_dev_limpar_sujo(dev, area->start_page, area->end_page);
+    }
+}
+
+// --------------------------------------------------------------
+// Zera o buffer; só as colunas que tinham algo aceso ficam sujas
+// --------------------------------------------------------------
+void oled_clear(uint8_t *buffer, struct render_area *area) {
+    int paginas = area->buffer_length / ssd1306_width;
+
+    if (paginas > 0) {
+        ssd1306_dev_limpar_paginas(ssd1306_padrao_quadro(buffer), 0, paginas - 1);
+    }
+}
+
+// --------------------------------------------------------------
+// Zera o buffer e envia a tela inteira
+// --------------------------------------------------------------
+void ssd1306_clear_display(uint8_t *buffer) {
+    ssd1306_dev_t *dev = ssd1306_padrao_quadro(buffer);
+
+    memset(buffer, 0, ssd1306_buffer_length);
+    ssd1306_dev_marcar_tudo_sujo(dev);
+    ssd1306_dev_flush(dev);
+}
+
+// --------------------------------------------------------------
+// Marca o retângulo (x0, y0)-(x1, y1), em pixels, como alterado
+// --------------------------------------------------------------
+void ssd1306_marcar_sujo(int x0, int y0, int x1, int y1) {
+    ssd1306_dev_marcar_sujo(ssd1306_padrao(), x0, y0, x1, y1);
+}
+
+void ssd1306_marcar_tudo_sujo(void) {
+    ssd1306_dev_marcar_tudo_sujo(ssd1306_padrao());
+}
+
+bool ssd1306_tem_sujo(void) {
+    return ssd1306_dev_tem_sujo(ssd1306_padrao());
+}
+
+// --------------------------------------------------------------
+// Envia ao display apenas as faixas sujas, uma janela por página
+// --------------------------------------------------------------
+void ssd1306_flush(uint8_t *buffer) {
+    ssd1306_dev_flush(ssd1306_padrao_quadro(buffer));
+}
+
+// --------------------------------------------------------------
+// Versão assíncrona (ver ssd1306_dev_flush_async)
+// --------------------------------------------------------------
+bool ssd1306_flush_async(uint8_t *buffer, ssd1306_async_callback_t callback, void *contexto) {
+    return ssd1306_dev_flush_async(ssd1306_padrao_quadro(buffer), callback, contexto);
+}
+
+// --------------------------------------------------------------
+// Apaga o display após um tempo de espera (em milissegundos)
+// --------------------------------------------------------------
+void limpar_oled_com_delay(uint8_t *buffer, struct render_area *area, uint delay_ms) {
+    sleep_ms(delay_ms);
+    oled_clear(buffer, area);
+    ssd1306_flush(buffer);
+}
+
+// --------------------------------------------------------------
+// Apaga o display imediatamente, sem espera
+// --------------------------------------------------------------
+void limpar_oled(uint8_t *buffer, struct render_area *area) {
+    oled_clear(buffer, area);
+    ssd1306_flush(buffer);
+}
@@ -0,0 +1,242 @@
+/**
+ * telas_emulador.c
+ *
+ * Telas do repositório desenhadas com a biblioteca e entregues ao emulador do
+ * controlador por três variantes de driver:
+ *
+ *   legado  - o driver original: cada comando numa transação (controle 0x80)
+ *             e o quadro inteiro a cada atualização;
+ *   lote    - janela e quadro inteiro numa sessão (render_on_display atual);
+ *   sujo    - só as faixas alteradas (ssd1306_dev_flush, cena, gráfico).
+ *
+ * O painel emulado de cada quadro é gravado em PBM e comparado com a imagem de
+ * referência em testes/referencias: as três variantes têm de mostrar a mesma
+ * tela, partindo de uma RAM com lixo. No fim, bytes e tempo de barramento por
+ * quadro (I2C a 400 kHz) de cada variante.
+ *
+ *   telas_emulador            compara com as referências
+ *   telas_emulador --gravar   regrava as referências (conferir as imagens antes)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306_dev.h"
+#include "ssd1306_cena.h"
+#include "ssd1306_rolagem.h"
+#include "ssd1306_emulador.h"
+#include "ssd1306_barramento_falso.h"
+#include "ssd1306_pbm.h"
+#include "teste.h"
+
+#define FREQUENCIA_I2C_HZ 400000
+#define MAX_QUADROS 16
+
+typedef enum {
+    LEGADO = 0,
+    LOTE,
+    SUJO,
+    VARIANTES,
+} variante_t;
+
+static const char *const nome_variante[VARIANTES] = { "legado", "lote", "sujo" };
+
+// Estado de uma tela em execução numa variante.
+typedef struct {
+    ssd1306_dev_t dev;
+    uint8_t quadro[SSD1306_QUADRO_TAMANHO(128, 64)];
+    ssd1306_cena_t cena;
+    ssd1306_elemento_t *elementos[4];
+    ssd1306_grafico_t grafico;
+} tela_t;
+
+// Um passo da tela: desenha o quadro 'n' no instante 'agora_ms'. Retorna false
+// quando a tela acabou.
+typedef bool (*passo_t)(tela_t *tela, int n);
+
+static bool gravar = false;
+static ssd1306_emulador_t emu;
+static ssd1306_falso_t descarte;        // Recebe o que o desenho enviaria nas variantes de quadro inteiro
+
+// --------------------------------------------------------------
+// Tela de estado do MQTT (tarefa_u2c3, setup_oled.c e main.c):
+// IP, conexão, PING e avisos temporários
+// --------------------------------------------------------------
+static bool passo_mqtt(tela_t *t, int n) {
+    static const uint32_t instantes[] = { 0, 1000, 2000, 3000, 3500, 6500 };
+    if (n >= (int)(sizeof(instantes) / sizeof(instantes[0]))) return false;
+    uint32_t agora = instantes[n];
+
+    if (n == 0) {
+        ssd1306_cena_iniciar(&t->cena, &t->dev);
+        t->elementos[0] = ssd1306_cena_texto(&t->cena, 0, 0, 128, 8, "");
+        t->elementos[1] = ssd1306_cena_texto(&t->cena, 0, 16, 128, 16, "");
+        t->elementos[2] = ssd1306_cena_texto(&t->cena, 0, 32, 128, 16, "");
+        t->elementos[3] = ssd1306_cena_texto(&t->cena, 0, 48, 128, 16, "");
+        ssd1306_elemento_temporario(t->elementos[3], "Núcleo 0\nIniciando!", 3000, agora);
+    } else if (n == 1) {
+        ssd1306_elemento_texto(t->elementos[0], "192.168.0.42");
+        ssd1306_elemento_texto(t->elementos[1], "MQTT: conectado");
+    } else if (n == 2) {
+        ssd1306_elemento_texto(t->elementos[2], "ACK do PING OK");
+    } else if (n == 4) {
+        ssd1306_elemento_temporario(t->elementos[3], "PING enviado...", 3000, agora);
+    }
+    ssd1306_cena_atualizar(&t->cena, agora);
+    return true;
+}
+
+// --------------------------------------------------------------
+// Alerta piscando centralizado (tarefa_u1c8_wifi, oled_messages.c)
+// --------------------------------------------------------------
+static bool passo_alerta(tela_t *t, int n) {
+    if (n >= 6) return false;
+    uint32_t agora = n * 500;
+
+    if (n == 0) {
+        ssd1306_cena_iniciar(&t->cena, &t->dev);
+        t->elementos[0] = ssd1306_cena_texto(&t->cena, 0, 24, 128, 8, "ALERTA ATIVO!");
+        t->elementos[0]->centralizar = true;
+        ssd1306_elemento_piscar(t->elementos[0], true, 500, agora);
+    } else if (n == 4) {
+        ssd1306_elemento_texto(t->elementos[0], "Sistema OK");
+        ssd1306_elemento_piscar(t->elementos[0], false, 500, agora);
+    }
+    ssd1306_cena_atualizar(&t->cena, agora);
+    return true;
+}
+
+// --------------------------------------------------------------
+// Temperatura do executivo cíclico (tarefa2_display.c): título,
+// gráfico de varredura nas páginas 1 a 3 e linha de tendência.
+// O valor grande usa bitmaps do projeto e fica de fora
+// --------------------------------------------------------------
+static bool passo_temperatura(tela_t *t, int n) {
+    static const float amostras[] = { 27.0f, 27.4f, 28.1f, 29.0f, 30.2f, 31.0f, 31.3f, 31.2f, 30.8f, 30.1f };
+    static const char *const tendencia[] = { "ESTAVEL +0.00C/m", "SUBINDO +1.35C/m", "CAINDO -0.72C/m" };
+    if (n >= (int)(sizeof(amostras) / sizeof(amostras[0]))) return false;
+
+    if (n == 0) {
+        ssd1306_dev_texto(&t->dev, (128 - 11 * 8) / 2, 0, "Temp. Media");
+        ssd1306_grafico_iniciar(&t->grafico, &t->dev, 0, 128, 1, 3, 20.0f, 44.0f);
+    }
+    ssd1306_grafico_adicionar(&t->grafico, amostras[n]);
+
+    int indice = n < 3 ? 0 : n < 7 ? 1 : 2;
+    if (n == 0 || n == 3 || n == 7) {
+        ssd1306_dev_limpar_paginas(&t->dev, 7, 7);
+        ssd1306_dev_texto_utf8(&t->dev, 0, 56, tendencia[indice]);
+    }
+    ssd1306_dev_flush(&t->dev);
+    return true;
+}
+
+static const struct {
+    const char *nome;
+    passo_t passo;
+} telas[] = {
+    { "mqtt", passo_mqtt },
+    { "alerta", passo_alerta },
+    { "temperatura", passo_temperatura },
+};
+
+// Quadro inteiro como o driver original: seis comandos, um por transação.
+static void enviar_legado(ssd1306_dev_t *dev) {
+    const uint8_t janela[] = { ssd1306_set_column_address, 0, 127, ssd1306_set_page_address, 0, 7 };
+    for (size_t i = 0; i < sizeof(janela); i++) {
+        uint8_t bytes[2] = { 0x80, janela[i] };
+        dev->cfg.barramento.escrever(dev->cfg.barramento.porta, dev->cfg.endereco, bytes, 2, false);
+    }
+    ssd1306_dev_enviar_dados(dev, dev->pixels, 128 * 8);
+}
+
+static void enviar_lote(ssd1306_dev_t *dev) {
+    ssd1306_fluxo_t fluxo;
+    ssd1306_fluxo_iniciar(&fluxo);
+    ssd1306_fluxo_janela(&fluxo, 0, 127, 0, 7);
+    ssd1306_dev_fluxo_enviar(dev, &fluxo, dev->pixels, 128 * 8);
+}
+
+// --------------------------------------------------------------
+// Roda uma tela numa variante e compara cada quadro do painel com
+// a referência. Nas variantes de quadro inteiro o desenho vai para
+// o descarte e o quadro é enviado depois, inteiro
+// --------------------------------------------------------------
+static void rodar(int indice_tela, variante_t variante) {
+    static tela_t tela;
+    const char *nome = telas[indice_tela].nome;
+    memset(&tela, 0, sizeof(tela));
+
+    ssd1306_emulador_iniciar(&emu, 128, 64, FREQUENCIA_I2C_HZ);
+    ssd1306_config_t cfg = {
+        .barramento = ssd1306_barramento_emulador(&emu),
+        .endereco = 0x3C,
+        .largura = 128,
+        .altura = 64,
+    };
+    ssd1306_dev_criar(&tela.dev, &cfg, tela.quadro);
+    ssd1306_dev_init(&tela.dev);
+
+    // A RAM do display liga com lixo: o primeiro quadro tem de cobri-la.
+    for (int i = 0; i < 8 * 128; i++) emu.ram[i / 128][i % 128] = (uint8_t)(i * 73 + 19);
+    ssd1306_dev_marcar_tudo_sujo(&tela.dev);
+
+    ssd1306_barramento_t barramento = tela.dev.cfg.barramento;
+    uint64_t bits = 0;
+    uint32_t bytes = 0, pior_us = 0;
+    int quadros = 0;
+
+    for (int n = 0; n < MAX_QUADROS; n++) {
+        ssd1306_emulador_zerar_contadores(&emu);
+
+        if (variante != SUJO) tela.dev.cfg.barramento = ssd1306_barramento_falso(&descarte);
+        bool continua = telas[indice_tela].passo(&tela, n);
+        tela.dev.cfg.barramento = barramento;
+        if (!continua) break;
+
+        if (variante == LEGADO) enviar_legado(&tela.dev);
+        if (variante == LOTE) enviar_lote(&tela.dev);
+        if (variante != SUJO) ssd1306_dev_limpar_sujo(&tela.dev, 0, SSD1306_PAGINAS_MAX - 1);
+
+        uint32_t us = ssd1306_emulador_tempo_us(&emu);
+        if (us > pior_us) pior_us = us;
+        bits += emu.bits;
+        bytes += emu.bytes;
+        quadros++;
+        VERIFICAR(emu.erros == 0, "%s/%s quadro %d: %u erros no emulador", nome, nome_variante[variante], n, emu.erros);
+
+        char caminho[512], referencia[512];
+        snprintf(referencia, sizeof(referencia), "%s/%s_%02d.pbm", REFERENCIAS, nome, n);
+        snprintf(caminho, sizeof(caminho), "%s_%s_%02d.pbm", nome, nome_variante[variante], n);
+        if (gravar && variante == LEGADO) {
+            VERIFICAR(ssd1306_emulador_salvar_pbm(&emu, referencia), "gravar %s", referencia);
+        }
+        VERIFICAR(ssd1306_emulador_salvar_pbm(&emu, caminho), "gravar %s", caminho);
+
+        FILE *a = fopen(caminho, "rb"), *b = fopen(referencia, "rb");
+        bool iguais = a && b;
+        while (iguais) {
+            int ca = fgetc(a), cb = fgetc(b);
+            if (ca != cb) iguais = false;
+            if (ca == EOF || cb == EOF) break;
+        }
+        if (a) fclose(a);
+        if (b) fclose(b);
+        VERIFICAR(iguais, "%s difere de %s", caminho, referencia);
+    }
+
+    uint32_t medio_us = quadros ? (uint32_t)(bits * 1000000u / FREQUENCIA_I2C_HZ / quadros) : 0;
+    printf("%-12s %-7s %3d quadros %7u bytes %6u B/quadro %7u us/quadro (pior %6u us) %6.0f fps\n",
+           nome, nome_variante[variante], quadros, bytes, quadros ? bytes / quadros : 0,
+           medio_us, pior_us, medio_us ? 1e6 / medio_us : 0.0);
+}
+
+int main(int argc, char **argv) {
+    gravar = argc > 1 && strcmp(argv[1], "--gravar") == 0;
+
+    for (size_t t = 0; t < sizeof(telas) / sizeof(telas[0]); t++) {
+        for (int v = 0; v < VARIANTES; v++) {
+            rodar((int)t, (variante_t)v);
+        }
+    }
+    return teste_resultado();
+}
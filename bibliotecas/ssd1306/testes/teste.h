@@ -0,0 +1,24 @@
+#ifndef TESTE_H
+#define TESTE_H
+
+#include <stdio.h>
+
+// Verificação mínima dos testes de host: conta as falhas e segue, para o
+// relatório mostrar todas de uma vez. main() retorna teste_resultado().
+static int teste_falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA %s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__);                    \
+        printf("\n");                           \
+        teste_falhas++;                         \
+    }                                           \
+} while (0)
+
+static inline int teste_resultado(void) {
+    printf(teste_falhas ? "%d falha(s)\n" : "ok\n", teste_falhas);
+    return teste_falhas ? 1 : 0;
+}
+
+#endif // TESTE_H
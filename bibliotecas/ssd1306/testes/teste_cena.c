@@ -0,0 +1,170 @@
+/**
+ * teste_cena.c
+ *
+ * Cena com alerta piscando, texto temporário e barra, atualizada por um relógio
+ * virtual. Cada quadro é gravado em PBM (relido e comparado com o quadro) e as
+ * janelas enviadas ao barramento falso são conferidas: só as páginas dos
+ * elementos que mudaram vão para o display.
+ *
+ *   teste_cena [pasta]     (padrão: diretório atual)
+ */
+
+#include <string.h>
+#include "ssd1306_cena.h"
+#include "ssd1306_barramento_falso.h"
+#include "ssd1306_pbm.h"
+#include "teste.h"
+
+static uint8_t quadro[SSD1306_QUADRO_TAMANHO(128, 64)];
+static ssd1306_falso_t falso;
+static ssd1306_dev_t dev;
+static ssd1306_cena_t cena;
+static const char *pasta = ".";
+static int quadros = 0;
+
+static bool pixel(int x, int y) {
+    return dev.pixels[(y / 8) * dev.cfg.largura + x] & (1u << (y % 8));
+}
+
+static int acesos(int x0, int y0, int x1, int y1) {
+    int n = 0;
+    for (int y = y0; y <= y1; y++)
+        for (int x = x0; x <= x1; x++) n += pixel(x, y);
+    return n;
+}
+
+// --------------------------------------------------------------
+// Páginas enviadas no último flush, como máscara de bits. Cada
+// sessão é 00 21 c0 c1 22 p p e depois 40 seguido dos dados
+// --------------------------------------------------------------
+static uint32_t paginas_enviadas(void) {
+    uint32_t mascara = 0;
+    size_t i = 0;
+    while (i + 8 <= falso.tamanho) {
+        const uint8_t *s = falso.registro + i;
+        if (s[0] != 0x00 || s[1] != 0x21 || s[4] != 0x22 || s[5] != s[6] || s[7] != 0x40) {
+            VERIFICAR(false, "sessao inesperada no byte %zu", i);
+            break;
+        }
+        mascara |= 1u << s[5];
+        i += 8 + (s[3] - s[2] + 1);
+    }
+    VERIFICAR(i == falso.tamanho, "sobraram %zu bytes no registro", falso.tamanho - i);
+    return mascara;
+}
+
+// O PBM gravado tem de ser o quadro: relê o arquivo e compara pixel a pixel.
+static void conferir_pbm(const char *caminho) {
+    FILE *f = fopen(caminho, "rb");
+    VERIFICAR(f != NULL, "%s nao foi gravado", caminho);
+    if (!f) return;
+
+    int largura = 0, altura = 0;
+    VERIFICAR(fscanf(f, "P4 %d %d", &largura, &altura) == 2 && largura == 128 && altura == 64,
+              "%s: cabecalho", caminho);
+    fgetc(f);
+
+    int diferentes = 0;
+    for (int y = 0; y < 64; y++) {
+        uint8_t linha[16];
+        if (fread(linha, 1, sizeof(linha), f) != sizeof(linha)) {
+            diferentes++;
+            break;
+        }
+        for (int x = 0; x < 128; x++) {
+            bool aceso = linha[x / 8] & (0x80 >> (x % 8));
+            if (aceso != pixel(x, y)) diferentes++;
+        }
+    }
+    fclose(f);
+    VERIFICAR(diferentes == 0, "%s: %d pixels diferentes do quadro", caminho, diferentes);
+}
+
+// Uma atualização no instante 'agora_ms': devolve as páginas enviadas.
+static uint32_t atualizar(uint32_t agora_ms, uint32_t *proximo) {
+    ssd1306_falso_limpar(&falso);
+    *proximo = ssd1306_cena_atualizar(&cena, agora_ms);
+
+    char caminho[256];
+    snprintf(caminho, sizeof(caminho), "%s/cena_%02d_%05ums.pbm", pasta, quadros++, agora_ms);
+    VERIFICAR(ssd1306_dev_salvar_pbm(&dev, caminho), "gravar %s", caminho);
+    conferir_pbm(caminho);
+
+    uint32_t paginas = paginas_enviadas();
+    printf("t=%5u ms: %4u bytes, paginas 0x%02X, proximo prazo %u ms\n",
+           agora_ms, falso.bytes, paginas, *proximo);
+    return paginas;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) pasta = argv[1];
+
+    ssd1306_config_t cfg = {
+        .barramento = ssd1306_barramento_falso(&falso),
+        .endereco = 0x3C,
+        .largura = 128,
+        .altura = 64,
+    };
+    ssd1306_dev_criar(&dev, &cfg, quadro);
+    ssd1306_cena_iniciar(&cena, &dev);
+
+    ssd1306_elemento_t *titulo = ssd1306_cena_texto(&cena, 0, 0, 128, 8, "Estado");
+    ssd1306_elemento_t *alerta = ssd1306_cena_texto(&cena, 0, 16, 128, 8, "ALERTA");
+    ssd1306_elemento_t *aviso = ssd1306_cena_texto(&cena, 0, 32, 128, 8, NULL);
+    ssd1306_elemento_t *barra = ssd1306_cena_barra(&cena, 0, 48, 128, 12);
+    titulo->centralizar = true;
+
+    ssd1306_elemento_piscar(alerta, true, 500, 0);
+    ssd1306_elemento_temporario(aviso, "Salvo", 1200, 0);
+    ssd1306_elemento_porcento(barra, 40);
+
+    uint32_t proximo;
+    uint32_t paginas = atualizar(0, &proximo);
+    VERIFICAR(paginas == 0xD5, "primeiro quadro: paginas 0x%02X", paginas);
+    VERIFICAR(proximo == 500, "primeiro prazo %u", proximo);
+    VERIFICAR(acesos(0, 16, 127, 23) > 0 && acesos(0, 32, 127, 39) > 0, "alerta e aviso visiveis");
+    VERIFICAR(acesos(2, 50, 2 + 124 * 40 / 100 - 1, 57) == (124 * 40 / 100) * 8, "barra a 40%%");
+    VERIFICAR(acesos(2 + 124 * 40 / 100, 50, 125, 57) == 0, "barra vazia depois de 40%%");
+
+    // Antes de qualquer prazo, nada muda e nada vai ao barramento.
+    paginas = atualizar(250, &proximo);
+    VERIFICAR(paginas == 0 && falso.bytes == 0, "sem prazo vencido: %u bytes", falso.bytes);
+    VERIFICAR(proximo == 250, "prazo em 250: %u", proximo);
+
+    // O alerta apaga e acende; só a página 2 é enviada.
+    paginas = atualizar(500, &proximo);
+    VERIFICAR(paginas == 1u << 2, "piscar (apaga): paginas 0x%02X", paginas);
+    VERIFICAR(acesos(0, 16, 127, 23) == 0, "alerta apagado");
+    paginas = atualizar(1000, &proximo);
+    VERIFICAR(paginas == 1u << 2, "piscar (acende): paginas 0x%02X", paginas);
+    VERIFICAR(acesos(0, 16, 127, 23) > 0, "alerta aceso");
+    VERIFICAR(proximo == 200, "aviso expira em 200: %u", proximo);
+
+    // O texto temporário some sozinho.
+    paginas = atualizar(1200, &proximo);
+    VERIFICAR(paginas == 1u << 4, "aviso expirado: paginas 0x%02X", paginas);
+    VERIFICAR(acesos(0, 32, 127, 39) == 0, "aviso apagado");
+    VERIFICAR(proximo == 300, "proximo piscar em 300: %u", proximo);
+
+    // A barra muda entre dois prazos: só as páginas 6 e 7.
+    ssd1306_elemento_porcento(barra, 75);
+    paginas = atualizar(1300, &proximo);
+    VERIFICAR(paginas == (1u << 6 | 1u << 7), "barra: paginas 0x%02X", paginas);
+    VERIFICAR(acesos(2, 50, 2 + 124 * 75 / 100 - 1, 57) == (124 * 75 / 100) * 8, "barra a 75%%");
+
+    // Valor igual não marca nada.
+    ssd1306_elemento_porcento(barra, 75);
+    ssd1306_elemento_texto(titulo, "Estado");
+    paginas = atualizar(1400, &proximo);
+    VERIFICAR(paginas == 0, "valores repetidos: paginas 0x%02X", paginas);
+
+    // Parar de piscar com o alerta apagado volta a mostrá-lo.
+    atualizar(1500, &proximo);
+    VERIFICAR(acesos(0, 16, 127, 23) == 0, "alerta apagado em 1500");
+    ssd1306_elemento_piscar(alerta, false, 0, 1600);
+    paginas = atualizar(1600, &proximo);
+    VERIFICAR(paginas == 1u << 2 && acesos(0, 16, 127, 23) > 0, "alerta fixo: paginas 0x%02X", paginas);
+    VERIFICAR(proximo == SSD1306_CENA_SEM_PRAZO, "sem prazos: %u", proximo);
+
+    return teste_resultado();
+}
@@ -0,0 +1,185 @@
+/**
+ * teste_flush.c
+ *
+ * Bytes e transações no barramento falso: flush só das faixas sujas, comandos
+ * agrupados numa transação e janela + dados na mesma sessão. Também confere,
+ * pixel a pixel, o glifo copiado coluna a coluna em qualquer 'y', os sinais
+ * '+', '-' e '/' da linha de tendência, e mede o tempo de uma tela cheia de texto.
+ */
+
+#include <string.h>
+#include <time.h>
+#include "ssd1306_dev.h"
+#include "ssd1306_barramento_falso.h"
+#include "teste.h"
+
+static uint8_t quadro[SSD1306_QUADRO_TAMANHO(128, 64)];
+static uint8_t quadro_ref[SSD1306_QUADRO_TAMANHO(128, 64)];
+static ssd1306_falso_t falso;
+
+static void criar(ssd1306_dev_t *dev, uint8_t *q) {
+    ssd1306_config_t cfg = {
+        .barramento = ssd1306_barramento_falso(&falso),
+        .endereco = 0x3C,
+        .largura = 128,
+        .altura = 64,
+    };
+    ssd1306_dev_criar(dev, &cfg, q);
+}
+
+static bool pixel(const ssd1306_dev_t *dev, int x, int y) {
+    return dev->pixels[(y / 8) * dev->cfg.largura + x] & (1u << (y % 8));
+}
+
+// Uma página suja: comandos de janela (7 bytes, RESTART) e dados com 0x40.
+static void testar_trecho_sujo(void) {
+    ssd1306_dev_t dev;
+    criar(&dev, quadro);
+
+    ssd1306_dev_flush(&dev);
+    VERIFICAR(falso.bytes == 0, "flush sem nada sujo enviou %u bytes", falso.bytes);
+
+    ssd1306_dev_texto(&dev, 16, 8, "AB");
+    ssd1306_dev_flush(&dev);
+
+    const uint8_t janela[] = { 0x00, 0x21, 16, 31, 0x22, 1, 1, 0x40 };
+    VERIFICAR(falso.bytes == sizeof(janela) + 16, "texto de 2 caracteres: %u bytes", falso.bytes);
+    VERIFICAR(falso.transacoes == 1, "texto de 2 caracteres: %u transacoes", falso.transacoes);
+    VERIFICAR(memcmp(falso.registro, janela, sizeof(janela)) == 0, "cabecalho da janela");
+    VERIFICAR(memcmp(falso.registro + sizeof(janela), dev.pixels + 128 + 16, 16) == 0, "dados da pagina");
+    VERIFICAR(dev.pixels[-1] == 0x40, "controle reservado do quadro");
+    VERIFICAR(!ssd1306_dev_tem_sujo(&dev), "sujo depois do flush");
+
+    // Dois pixels em páginas diferentes: uma sessão por página, uma coluna cada.
+    ssd1306_falso_limpar(&falso);
+    ssd1306_dev_pixel(&dev, 5, 0, true);
+    ssd1306_dev_pixel(&dev, 100, 60, true);
+    ssd1306_dev_flush(&dev);
+    VERIFICAR(falso.transacoes == 2 && falso.bytes == 2 * (sizeof(janela) + 1),
+              "dois pixels: %u transacoes, %u bytes", falso.transacoes, falso.bytes);
+
+    // Apagar e redesenhar o mesmo texto custa só o texto.
+    ssd1306_falso_limpar(&falso);
+    ssd1306_dev_limpar_paginas(&dev, 1, 1);
+    ssd1306_dev_texto(&dev, 16, 8, "AB");
+    ssd1306_dev_flush(&dev);
+    VERIFICAR(falso.bytes == sizeof(janela) + 16, "redesenho do texto: %u bytes", falso.bytes);
+
+    // Quadro inteiro: 8 sessões de uma página.
+    ssd1306_falso_limpar(&falso);
+    uint32_t enviados = dev.bytes_enviados;
+    ssd1306_dev_marcar_tudo_sujo(&dev);
+    ssd1306_dev_flush(&dev);
+    VERIFICAR(falso.transacoes == 8 && falso.bytes == 8 * (sizeof(janela) + 128),
+              "quadro inteiro: %u transacoes, %u bytes", falso.transacoes, falso.bytes);
+    VERIFICAR(dev.bytes_enviados - enviados == falso.bytes, "contador da instancia %u, barramento %u",
+              dev.bytes_enviados - enviados, falso.bytes);
+}
+
+// A inicialização vai numa transação só, com um único controle 0x00.
+static void testar_comandos(void) {
+    ssd1306_dev_t dev;
+    criar(&dev, quadro);
+
+    ssd1306_dev_init(&dev);
+    VERIFICAR(falso.transacoes == 1, "init: %u transacoes", falso.transacoes);
+    VERIFICAR(falso.registro[0] == 0x00, "init: controle 0x%02X", falso.registro[0]);
+    printf("init: %u bytes numa transacao\n", falso.bytes);
+
+    // Uma lista maior que o fluxo é dividida em blocos de SSD1306_FLUXO_MAX.
+    uint8_t nops[SSD1306_FLUXO_MAX + 5];
+    memset(nops, 0xE3, sizeof(nops));
+    ssd1306_falso_limpar(&falso);
+    ssd1306_dev_comandos(&dev, nops, sizeof(nops));
+    VERIFICAR(falso.transacoes == 2 && falso.bytes == sizeof(nops) + 2,
+              "lista longa: %u transacoes, %u bytes", falso.transacoes, falso.bytes);
+}
+
+// --------------------------------------------------------------
+// Glifo em y qualquer igual ao glifo alinhado deslocado, com a
+// célula de 8 linhas substituída e o resto do quadro preservado
+// --------------------------------------------------------------
+static void testar_glifo(void) {
+    ssd1306_dev_t dev, ref;
+    criar(&dev, quadro);
+    criar(&ref, quadro_ref);
+
+    const char *texto = "Aç9?";
+    ssd1306_dev_texto_utf8(&ref, 0, 0, texto);
+
+    for (int y = 0; y <= 56; y++) {
+        memset(dev.pixels, 0xA5, 128 * 8);
+        ssd1306_dev_limpar_sujo(&dev, 0, SSD1306_PAGINAS_MAX - 1);
+        ssd1306_dev_texto_utf8(&dev, 9, y, texto);
+
+        int erros = 0;
+        for (int py = 0; py < 64; py++) {
+            for (int px = 0; px < 128; px++) {
+                bool esperado;
+                if (px >= 9 && px < 9 + 32 && py >= y && py < y + 8) {
+                    esperado = pixel(&ref, px - 9, py - y);
+                } else {
+                    esperado = (0xA5 >> (py % 8)) & 1;
+                }
+                if (pixel(&dev, px, py) != esperado) erros++;
+            }
+        }
+        VERIFICAR(erros == 0, "glifo em y=%d: %d pixels diferentes", y, erros);
+
+        // A região suja cobre exatamente as páginas da célula.
+        for (int p = 0; p < 8; p++) {
+            bool atingida = p == y / 8 || p == (y + 7) / 8;
+            bool suja = dev.sujo_x0[p] <= dev.sujo_x1[p];
+            VERIFICAR(suja == atingida, "y=%d: pagina %d suja=%d", y, p, suja);
+            if (suja) VERIFICAR(dev.sujo_x0[p] == 9 && dev.sujo_x1[p] == 40,
+                                "y=%d: faixa %u..%u", y, dev.sujo_x0[p], dev.sujo_x1[p]);
+        }
+    }
+}
+
+// Sinais da linha de tendência ("CAINDO -0.72C/m"): cada caractere que não é
+// espaço acende pixels, e '+', '-' e '/' têm glifos distintos.
+static void testar_sinais(void) {
+    ssd1306_dev_t dev;
+    criar(&dev, quadro);
+    memset(dev.pixels, 0, 128 * 8);
+
+    const char *linha = "CAINDO -0.72C/m+";
+    ssd1306_dev_texto(&dev, 0, 0, linha);
+    for (int i = 0; linha[i]; i++) {
+        int acesos = 0;
+        for (int c = 0; c < 8; c++) acesos += dev.pixels[i * 8 + c] != 0;
+        VERIFICAR((linha[i] == ' ') == (acesos == 0), "'%c' na coluna %d: %d colunas acesas", linha[i], i, acesos);
+    }
+
+    const uint8_t *menos = dev.pixels + 7 * 8, *barra = dev.pixels + 13 * 8, *mais = dev.pixels + 15 * 8;
+    VERIFICAR(memcmp(menos, mais, 8) != 0 && memcmp(menos, barra, 8) != 0 && memcmp(mais, barra, 8) != 0,
+              "'+', '-' e '/' com o mesmo glifo");
+}
+
+// Tela cheia de texto (16 x 8 caracteres) desalinhada, a pior posição.
+static void bancada_texto(void) {
+    ssd1306_dev_t dev;
+    criar(&dev, quadro);
+    const char *tela = "Pressione o botao A para iniciar a leitura do sensor de temperatura. "
+                       "Tensão, corrente e potência aparecem em seguida na tela. Olá!";
+    const int repeticoes = 20000;
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int r = 0; r < repeticoes; r++) {
+        ssd1306_dev_texto_utf8_multilinha(&dev, 0, r & 7 ? 3 : 0, tela);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / repeticoes;
+    printf("tela cheia de texto: %.0f ns\n", ns);
+}
+
+int main(void) {
+    testar_trecho_sujo();
+    testar_comandos();
+    testar_glifo();
+    testar_sinais();
+    bancada_texto();
+    return teste_resultado();
+}
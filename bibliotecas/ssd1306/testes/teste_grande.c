@@ -0,0 +1,159 @@
+/**
+ * teste_grande.c
+ *
+ * Número grande (ssd1306_grande) no emulador do controlador, como o valor da
+ * tarefa_u1c9_ciclico e o contador da tarefa_u3c1:
+ *  - os dígitos vêm de um cache de colunas de página montado uma vez (a fonte
+ *    8x8 dobrada para 16x16), como o de big_string_drawer.c;
+ *  - a cada troca de valor só as colunas dos dígitos que mudaram ficam sujas,
+ *    e o flush envia só elas;
+ *  - o painel emulado de cada passo é comparado com testes/referencias.
+ *
+ *   teste_grande            compara com as referências
+ *   teste_grande --gravar   regrava as referências (conferir as imagens antes)
+ */
+
+#include <string.h>
+#include "ssd1306_dev.h"
+#include "ssd1306_grande.h"
+#include "ssd1306_emulador.h"
+#include "ssd1306_pbm.h"
+#include "ssd1306_font.h"
+#include "teste.h"
+
+#define LARGURA_DIGITO 16
+#define PAGINAS_DIGITO 2
+#define PAGINA_TOPO 3
+#define INDICE_FONTE_ZERO 27    // Posição de '0' em font[] (ver ssd1306_get_font)
+
+static uint8_t colunas[10][LARGURA_DIGITO * PAGINAS_DIGITO];
+static ssd1306_glifo_grande_t digitos[10];
+
+static uint8_t quadro[SSD1306_QUADRO_TAMANHO(128, 64)];
+static ssd1306_emulador_t emu;
+static ssd1306_dev_t dev;
+static ssd1306_grande_t numero;
+static bool gravar = false;
+
+// Cinco posições alinhadas à direita, como update_big_string_aligned_right.
+static const int16_t posicoes[5] = { 48, 64, 80, 96, 112 };
+
+// Cada coluna da fonte vira duas colunas, e cada linha duas linhas (16 bits
+// divididos nas duas páginas).
+static void montar_cache(void) {
+    for (int d = 0; d < 10; d++) {
+        const uint8_t *fonte = &font[(INDICE_FONTE_ZERO + d) * 8];
+        for (int c = 0; c < 8; c++) {
+            uint16_t dobrada = 0;
+            for (int bit = 0; bit < 8; bit++) {
+                if (fonte[c] & (1u << bit)) dobrada |= 3u << (2 * bit);
+            }
+            for (int k = 0; k < 2; k++) {
+                colunas[d][(2 * c + k) * PAGINAS_DIGITO + 0] = dobrada & 0xFF;
+                colunas[d][(2 * c + k) * PAGINAS_DIGITO + 1] = dobrada >> 8;
+            }
+        }
+        digitos[d] = (ssd1306_glifo_grande_t){
+            .largura = LARGURA_DIGITO,
+            .paginas = PAGINAS_DIGITO,
+            .passo = PAGINAS_DIGITO,
+            .colunas = colunas[d],
+        };
+    }
+}
+
+static void exibir(const char *valor) {
+    const ssd1306_glifo_grande_t *glifos[5];
+    int quantidade = (int)strlen(valor);
+    for (int i = 0; i < quantidade; i++) {
+        glifos[i] = valor[i] == ' ' ? NULL : &digitos[valor[i] - '0'];
+    }
+    ssd1306_grande_exibir(&numero, posicoes, glifos, quantidade);
+}
+
+// Só as páginas do número, e nelas exatamente as colunas x0..x1, estão sujas.
+static void conferir_sujo(const char *passo, int x0, int x1) {
+    for (int p = 0; p < dev.paginas; p++) {
+        bool do_numero = p >= PAGINA_TOPO && p < PAGINA_TOPO + PAGINAS_DIGITO;
+        if (do_numero && x0 <= x1) {
+            VERIFICAR(dev.sujo_x0[p] == x0 && dev.sujo_x1[p] == x1, "%s: página %d suja em %u..%u, esperado %d..%d",
+                      passo, p, dev.sujo_x0[p], dev.sujo_x1[p], x0, x1);
+        } else {
+            VERIFICAR(dev.sujo_x0[p] > dev.sujo_x1[p], "%s: página %d suja em %u..%u",
+                      passo, p, dev.sujo_x0[p], dev.sujo_x1[p]);
+        }
+    }
+}
+
+// Envia e compara o painel com a referência; o barramento só leva as colunas sujas.
+static void conferir_painel(const char *passo, int n, int colunas_sujas) {
+    ssd1306_emulador_zerar_contadores(&emu);
+    ssd1306_dev_flush(&dev);
+    VERIFICAR(emu.erros == 0, "%s: %u erros no emulador", passo, emu.erros);
+    VERIFICAR(emu.dados == (uint32_t)colunas_sujas * PAGINAS_DIGITO, "%s: %u bytes de pixels, esperado %d",
+              passo, emu.dados, colunas_sujas * PAGINAS_DIGITO);
+
+    char caminho[512], referencia[512];
+    snprintf(referencia, sizeof(referencia), "%s/grande_%02d.pbm", REFERENCIAS, n);
+    snprintf(caminho, sizeof(caminho), "grande_%02d.pbm", n);
+    if (gravar) {
+        VERIFICAR(ssd1306_emulador_salvar_pbm(&emu, referencia), "gravar %s", referencia);
+    }
+    VERIFICAR(ssd1306_emulador_salvar_pbm(&emu, caminho), "gravar %s", caminho);
+
+    FILE *a = fopen(caminho, "rb"), *b = fopen(referencia, "rb");
+    bool iguais = a && b;
+    while (iguais) {
+        int ca = fgetc(a), cb = fgetc(b);
+        if (ca != cb) iguais = false;
+        if (ca == EOF || cb == EOF) break;
+    }
+    if (a) fclose(a);
+    if (b) fclose(b);
+    VERIFICAR(iguais, "%s: %s difere de %s", passo, caminho, referencia);
+}
+
+int main(int argc, char **argv) {
+    gravar = argc > 1 && strcmp(argv[1], "--gravar") == 0;
+    montar_cache();
+
+    ssd1306_emulador_iniciar(&emu, 128, 64, 400000);
+    ssd1306_config_t cfg = {
+        .barramento = ssd1306_barramento_emulador(&emu),
+        .endereco = 0x3C,
+        .largura = 128,
+        .altura = 64,
+    };
+    ssd1306_dev_criar(&dev, &cfg, quadro);
+    ssd1306_dev_init(&dev);
+    ssd1306_dev_limpar(&dev);
+    ssd1306_dev_flush(&dev);
+    ssd1306_grande_iniciar(&numero, &dev, PAGINA_TOPO);
+
+    // Primeiro valor: as cinco posições.
+    exibir("12345");
+    conferir_sujo("12345", 48, 127);
+    conferir_painel("12345", 0, 80);
+
+    // Um dígito no meio.
+    exibir("12945");
+    conferir_sujo("12945", 80, 95);
+    conferir_painel("12945", 1, 16);
+
+    // Os dois últimos.
+    exibir("12978");
+    conferir_sujo("12978", 96, 127);
+    conferir_painel("12978", 2, 32);
+
+    // Mesmo valor: nada a enviar.
+    exibir("12978");
+    conferir_sujo("12978 de novo", 1, 0);
+    conferir_painel("12978 de novo", 2, 0);
+
+    // Posição que some (glifo NULL) é apagada; as outras continuam.
+    exibir(" 2978");
+    conferir_sujo(" 2978", 48, 63);
+    conferir_painel(" 2978", 3, 16);
+
+    return teste_resultado();
+}
@@ -0,0 +1,121 @@
+/**
+ * teste_heap.c
+ *
+ * Heap no caminho de atualização, em 10 mil quadros cheios no barramento falso:
+ *  - antes: a cópia de ssd1306_send_buffer() (malloc do quadro + 0x40, memcpy,
+ *    free) a cada quadro;
+ *  - agora: ssd1306_dev_enviar_dados() transmitindo o quadro no lugar, com o
+ *    controle reservado em ssd1306_framebuffer_t.
+ * A cada 100 quadros outra "tarefa" aloca uma mensagem que vive até o fim, como
+ * uma fila criada enquanto o display atualiza. O heap é medido com mallinfo2()
+ * antes e depois de cada caminho: operações, pico em uso, crescimento da arena e
+ * blocos livres (fragmentação).
+ */
+
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_dev.h"
+#include "ssd1306_barramento_falso.h"
+#include "teste.h"
+
+#define QUADROS 10000
+#define MENSAGEM_A_CADA 100
+#define MENSAGEM_TAMANHO 24
+
+static uint8_t quadro[SSD1306_QUADRO_TAMANHO(128, 64)];
+static ssd1306_falso_t falso;
+static void *mensagens[QUADROS / MENSAGEM_A_CADA];
+
+// Em uso no início do caminho medido e o maior valor visto desde então.
+static size_t em_uso_inicial, pico_em_uso;
+
+// Amostra no ponto de maior uso de cada caminho: durante a escrita no barramento.
+static void amostrar(void) {
+    size_t em_uso = mallinfo2().uordblks - em_uso_inicial;
+    if (em_uso > pico_em_uso) pico_em_uso = em_uso;
+}
+
+typedef struct {
+    unsigned operacoes;     // malloc + free do caminho do display
+    size_t pico_em_uso;     // Maior uordblks durante o caminho, acima do inicial
+    size_t arena;           // Crescimento da arena
+    size_t livres;          // Bytes livres retidos no heap ao fim
+    size_t blocos_livres;   // Blocos livres ao fim
+} medida_t;
+
+// ssd1306_send_buffer() antes do quadro com controle reservado.
+static unsigned enviar_com_copia(ssd1306_dev_t *dev, const uint8_t *pixels, int tamanho, int quadro_n) {
+    uint8_t *copia = malloc(tamanho + 1);
+    copia[0] = 0x40;
+    memcpy(copia + 1, pixels, tamanho);
+
+    // A mensagem da outra tarefa chega com a cópia ainda viva.
+    if (quadro_n % MENSAGEM_A_CADA == 0) mensagens[quadro_n / MENSAGEM_A_CADA] = malloc(MENSAGEM_TAMANHO);
+
+    amostrar();
+    dev->cfg.barramento.escrever(dev->cfg.barramento.porta, dev->cfg.endereco, copia, tamanho + 1, false);
+    free(copia);
+    return 2;
+}
+
+static unsigned enviar_no_lugar(ssd1306_dev_t *dev, uint8_t *pixels, int tamanho, int quadro_n) {
+    if (quadro_n % MENSAGEM_A_CADA == 0) mensagens[quadro_n / MENSAGEM_A_CADA] = malloc(MENSAGEM_TAMANHO);
+
+    amostrar();
+    ssd1306_dev_enviar_dados(dev, pixels, tamanho);
+    return 0;
+}
+
+static medida_t medir(bool com_copia) {
+    ssd1306_config_t cfg = {
+        .barramento = ssd1306_barramento_falso(&falso),
+        .endereco = 0x3C,
+        .largura = 128,
+        .altura = 64,
+    };
+    ssd1306_dev_t dev;
+    ssd1306_dev_criar(&dev, &cfg, quadro);
+    ssd1306_falso_limpar(&falso);
+
+    medida_t m = { 0 };
+    struct mallinfo2 antes = mallinfo2();
+    em_uso_inicial = antes.uordblks;
+    pico_em_uso = 0;
+    for (int i = 0; i < QUADROS; i++) {
+        dev.pixels[i % (128 * 8)] ^= 0xFF;
+        m.operacoes += com_copia ? enviar_com_copia(&dev, dev.pixels, 128 * 8, i)
+                                 : enviar_no_lugar(&dev, dev.pixels, 128 * 8, i);
+    }
+    struct mallinfo2 depois = mallinfo2();
+    m.pico_em_uso = pico_em_uso;
+    m.arena = depois.arena - antes.arena;
+    m.livres = depois.fordblks;
+    m.blocos_livres = depois.ordblks;
+
+    VERIFICAR(falso.bytes == QUADROS * (128 * 8 + 1), "%s: %u bytes no barramento",
+              com_copia ? "cópia" : "no lugar", falso.bytes);
+    for (unsigned k = 0; k < QUADROS / MENSAGEM_A_CADA; k++) free(mensagens[k]);
+    return m;
+}
+
+static void imprimir(const char *nome, const medida_t *m) {
+    printf("%-9s %6u ops de heap, pico %5zu B em uso, arena +%zu B, %zu B livres em %zu blocos\n",
+           nome, m->operacoes, m->pico_em_uso, m->arena, m->livres, m->blocos_livres);
+}
+
+int main(void) {
+    // A arena nasce no primeiro malloc; o caminho novo vai primeiro, sem restos do antigo.
+    free(malloc(1));
+    medida_t agora = medir(false);
+    medida_t antes = medir(true);
+    imprimir("antes:", &antes);
+    imprimir("agora:", &agora);
+
+    // Agora o heap só vê as mensagens da outra tarefa.
+    size_t mensagens_b = (QUADROS / MENSAGEM_A_CADA) * MENSAGEM_TAMANHO;
+    VERIFICAR(agora.operacoes == 0, "caminho no lugar fez %u operações de heap", agora.operacoes);
+    VERIFICAR(agora.pico_em_uso < mensagens_b * 2, "caminho no lugar: pico de %zu B", agora.pico_em_uso);
+    VERIFICAR(antes.pico_em_uso >= 128 * 8 + 1, "cópia sem o quadro no heap: pico de %zu B", antes.pico_em_uso);
+    return teste_resultado();
+}
@@ -0,0 +1,154 @@
+/**
+ * teste_rolagem.c
+ *
+ * Log pela linha inicial e gráfico de varredura. No barramento falso: cada
+ * linha do log custa uma página e, depois que a tela enche, um comando de
+ * linha inicial; cada amostra do gráfico é uma sessão de duas colunas. No
+ * emulador: o painel mostra as últimas linhas na ordem certa e as colunas do
+ * gráfico chegam à RAM como estão no quadro.
+ */
+
+#include <string.h>
+#include "ssd1306_rolagem.h"
+#include "ssd1306_barramento_falso.h"
+#include "ssd1306_emulador.h"
+#include "teste.h"
+
+#define LINHAS_LOG 20
+
+static uint8_t quadro[SSD1306_QUADRO_TAMANHO(128, 64)];
+static uint8_t quadro_ref[SSD1306_QUADRO_TAMANHO(128, 64)];
+static ssd1306_falso_t falso;
+static ssd1306_emulador_t emu;
+
+static void criar(ssd1306_dev_t *dev, ssd1306_barramento_t barramento, uint8_t *q) {
+    ssd1306_config_t cfg = {
+        .barramento = barramento,
+        .endereco = 0x3C,
+        .largura = 128,
+        .altura = 64,
+    };
+    ssd1306_dev_criar(dev, &cfg, q);
+}
+
+static void texto_linha(char *destino, int n) {
+    snprintf(destino, 17, "Linha %d", n);
+}
+
+// Páginas de dados de uma sessão de flush (00 21 c0 c1 22 p p 40 ...).
+static int pagina_da_sessao(const uint8_t *s) {
+    if (s[0] != 0x00 || s[1] != 0x21 || s[4] != 0x22 || s[5] != s[6] || s[7] != 0x40) return -1;
+    return s[5];
+}
+
+static void testar_log_bytes(void) {
+    ssd1306_dev_t dev;
+    ssd1306_log_t log;
+    char texto[17];
+
+    criar(&dev, ssd1306_barramento_falso(&falso), quadro);
+    VERIFICAR(ssd1306_log_iniciar(&log, &dev), "log em 128x64");
+
+    for (int n = 0; n < LINHAS_LOG; n++) {
+        texto_linha(texto, n);
+        ssd1306_falso_limpar(&falso);
+        ssd1306_log_adicionar(&log, texto);
+
+        bool rolou = n >= 8;
+        int pagina = pagina_da_sessao(falso.registro);
+        int esperada = rolou ? (n - 8) % 8 : n;
+        size_t sessao = 8 + (size_t)(falso.registro[3] - falso.registro[2] + 1);
+
+        VERIFICAR(pagina == esperada, "linha %d: pagina %d, esperada %d", n, pagina, esperada);
+        VERIFICAR(falso.transacoes == (rolou ? 2u : 1u), "linha %d: %u transacoes", n, falso.transacoes);
+        if (rolou) {
+            // Depois dos dados, só o comando de linha inicial (controle + 1 byte).
+            VERIFICAR(falso.tamanho == sessao + 2, "linha %d: %zu bytes, sessao de %zu",
+                      n, falso.tamanho, sessao);
+            VERIFICAR(falso.registro[sessao] == 0x00 &&
+                      falso.registro[sessao + 1] == (0x40 | ((n - 7) % 8) * 8),
+                      "linha %d: linha inicial 0x%02X", n, falso.registro[sessao + 1]);
+        } else {
+            VERIFICAR(falso.tamanho == sessao, "linha %d: %zu bytes, sessao de %zu", n, falso.tamanho, sessao);
+        }
+    }
+    printf("log: %u bytes na ultima linha\n", falso.bytes);
+}
+
+// --------------------------------------------------------------
+// No painel emulado, a linha k da tela mostra a linha de log
+// LINHAS_LOG - 8 + k, como um quadro desenhado do zero
+// --------------------------------------------------------------
+static void testar_log_painel(void) {
+    ssd1306_dev_t dev, ref;
+    ssd1306_log_t log;
+    char texto[17];
+
+    ssd1306_emulador_iniciar(&emu, 128, 64, 400000);
+    criar(&dev, ssd1306_barramento_emulador(&emu), quadro);
+    criar(&ref, ssd1306_barramento_falso(&falso), quadro_ref);
+    ssd1306_dev_init(&dev);
+    ssd1306_log_iniciar(&log, &dev);
+
+    for (int n = 0; n < LINHAS_LOG; n++) {
+        texto_linha(texto, n);
+        ssd1306_log_adicionar(&log, texto);
+    }
+    for (int k = 0; k < 8; k++) {
+        texto_linha(texto, LINHAS_LOG - 8 + k);
+        ssd1306_dev_texto_utf8(&ref, 0, k * 8, texto);
+    }
+
+    int diferentes = 0;
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 128; x++) {
+            bool esperado = ref.pixels[(y / 8) * 128 + x] & (1u << (y % 8));
+            if (ssd1306_emulador_pixel(&emu, x, y) != esperado) diferentes++;
+        }
+    }
+    VERIFICAR(diferentes == 0, "painel do log: %d pixels diferentes", diferentes);
+    VERIFICAR(emu.erros == 0, "emulador: %u erros", emu.erros);
+
+    ssd1306_log_encerrar(&log);
+    VERIFICAR(emu.linha_inicial == 0, "linha inicial depois de encerrar: %u", emu.linha_inicial);
+}
+
+// Cada amostra: uma sessão com as duas colunas, e a RAM igual ao quadro.
+static void testar_grafico(void) {
+    ssd1306_dev_t dev;
+    ssd1306_grafico_t grafico;
+
+    ssd1306_emulador_iniciar(&emu, 128, 64, 400000);
+    criar(&dev, ssd1306_barramento_emulador(&emu), quadro);
+    ssd1306_dev_init(&dev);
+    ssd1306_grafico_iniciar(&grafico, &dev, 20, 40, 2, 4, 0.f, 100.f);
+
+    for (int n = 0; n < 100; n++) {
+        ssd1306_emulador_zerar_contadores(&emu);
+        ssd1306_grafico_adicionar(&grafico, (float)((n * 37) % 101));
+
+        // Na volta (cursor na última coluna) as duas colunas não são vizinhas.
+        bool volta = n % 40 == 39;
+        uint32_t colunas = volta ? 1 : 2;
+        uint32_t sessoes = volta ? 2 : 1;
+        VERIFICAR(emu.transacoes == sessoes, "amostra %d: %u transacoes", n, emu.transacoes);
+        VERIFICAR(emu.bytes == sessoes * (7 + 1 + colunas * 4), "amostra %d: %u bytes", n, emu.bytes);
+        VERIFICAR(emu.modo == SSD1306_EMULADOR_HORIZONTAL, "amostra %d: modo %d", n, emu.modo);
+    }
+
+    int diferentes = 0;
+    for (int p = 0; p < 8; p++) {
+        for (int x = 0; x < 128; x++) {
+            if (emu.ram[p][x] != dev.pixels[p * 128 + x]) diferentes++;
+        }
+    }
+    VERIFICAR(diferentes == 0, "RAM do grafico: %d bytes diferentes do quadro", diferentes);
+    VERIFICAR(emu.erros == 0, "emulador: %u erros", emu.erros);
+}
+
+int main(void) {
+    testar_log_bytes();
+    testar_log_painel();
+    testar_grafico();
+    return teste_resultado();
+}
@@ -1,6 +1,6 @@
 #include "pico/stdlib.h"
 #include "pico/multicore.h"
-#include "hardware/adc.h"
+#include "adc_amostrador.h"
 #include "hardware/gpio.h"
 
 // Definições de hardware
@@ -9,6 +9,7 @@
 #define LED_GREEN 11     // GPIO11 - LED verde
 #define BUZZER 10        // GPIO10 - Buzzer ativo
 #define JOYSTICK_Y 26    // GPIO26 (ADC0) - Eixo Y do joystick
+#define JOYSTICK_Y_CANAL 0
 #define JOYSTICK_SW 22   // GPIO22 - Botão do joystick
 
 // Estados do sistema
@@ -30,15 +31,18 @@ int64_t alarm_callback(alarm_id_t id, void *user_data) {
 
 /**
  * Núcleo 0: Leitura de entradas
- * - Configura ADC para joystick
+ * - Inicia o amostrador do ADC para o joystick
  * - Ativa pull-up no botão
  * - Atualiza estado conforme posição do joystick
  * - Força estado crítico se botão pressionado
  */
 void core0_entry() {
-    adc_init();
-    adc_gpio_init(JOYSTICK_Y);
-    adc_select_input(0);
+    // 800 Hz, guardando a média de 8 conversões (100 amostras/s)
+    static const adc_decimacao_t decimacao[ADC_AMOSTRADOR_CANAIS] = {
+        [JOYSTICK_Y_CANAL] = { .ordem = 1, .log2_fator = 3 },
+    };
+    adc_amostrador_iniciar(ADC_MASCARA(JOYSTICK_Y_CANAL), 800, decimacao);
+    while (!adc_amostrador_tem_amostra(JOYSTICK_Y_CANAL)) sleep_ms(1);  // Primeira média (10 ms)
 
     gpio_init(JOYSTICK_SW);
     gpio_set_dir(JOYSTICK_SW, GPIO_IN);
@@ -47,7 +51,7 @@ void core0_entry() {
     add_alarm_in_ms(2000, alarm_callback, NULL, true);
 
     while (true) {
-        uint16_t joystick_val = adc_read();
+        uint16_t joystick_val = adc_amostrador_ultimo(JOYSTICK_Y_CANAL);
 
         if (joystick_val < LIMIAR_BAIXO) flag_estado = 1;
         else if (joystick_val < LIMIAR_MODERADO) flag_estado = 2;
@@ -0,0 +1,74 @@
+#include "mic_dsp.h"
+
+void mic_dsp_init(mic_dsp_t *dsp) {
+  for (uint32_t i = 0; i < MIC_MEDIA_BLOCOS; ++i)
+    dsp->historico[i] = 0;
+  dsp->soma = 0;
+  dsp->indice = 0;
+  dsp->preenchidos = 0;
+}
+
+/**
+ * Raiz quadrada inteira (arredondada para baixo), bit a bit, sem ponto flutuante.
+ */
+uint32_t mic_isqrt(uint64_t x) {
+  uint64_t raiz = 0;
+  uint64_t bit = 1ull << 62;
+
+  while (bit > x)
+    bit >>= 2;
+
+  while (bit) {
+    if (x >= raiz + bit) {
+      x -= raiz + bit;
+      raiz = (raiz >> 1) + bit;
+    } else {
+      raiz >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint32_t)raiz;
+}
+
+/**
+ * Processa um bloco de amostras de 12 bits só com aritmética inteira.
+ *
+ * Uma passada acumula soma e soma dos quadrados (centradas em 2048 para caber em 32 bits por
+ * amostra); a variância sai de Σx²/n - (Σx/n)², então o RMS já é calculado sem o DC.
+ * Uma segunda passada, barata, mede o pico em torno do DC do próprio bloco.
+ */
+void mic_dsp_processar(mic_dsp_t *dsp, const uint16_t *amostras, uint32_t n, mic_metricas_t *saida) {
+  int32_t soma = 0;
+  uint64_t soma_quadrados = 0;
+
+  for (uint32_t i = 0; i < n; ++i) {
+    int32_t x = (int32_t)(amostras[i] & 0x0FFF) - 2048;
+    soma += x;
+    soma_quadrados += (uint32_t)(x * x);
+  }
+
+  // n * Σx² - (Σx)² = n² * variância, evitando divisões antes da raiz.
+  int64_t n2_var = (int64_t)n * (int64_t)soma_quadrados - (int64_t)soma * soma;
+  if (n2_var < 0) n2_var = 0;
+
+  int32_t dc = 2048 + soma / (int32_t)n;
+  saida->dc = (uint16_t)dc;
+  saida->rms = (uint16_t)(mic_isqrt((uint64_t)n2_var) / n);
+
+  uint32_t pico = 0;
+  for (uint32_t i = 0; i < n; ++i) {
+    int32_t d = (int32_t)(amostras[i] & 0x0FFF) - dc;
+    uint32_t m = d < 0 ? -d : d;
+    if (m > pico) pico = m;
+  }
+  saida->pico = (uint16_t)pico;
+
+  // Média móvel: troca o valor mais antigo do histórico pelo RMS deste bloco.
+  dsp->soma -= dsp->historico[dsp->indice];
+  dsp->historico[dsp->indice] = saida->rms;
+  dsp->soma += saida->rms;
+  dsp->indice = (dsp->indice + 1) & (MIC_MEDIA_BLOCOS - 1);
+  if (dsp->preenchidos < MIC_MEDIA_BLOCOS) dsp->preenchidos++;
+
+  saida->media_movel = (uint16_t)(dsp->soma / dsp->preenchidos);
+}
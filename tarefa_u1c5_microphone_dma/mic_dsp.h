@@ -0,0 +1,29 @@
+#ifndef MIC_DSP_H
+#define MIC_DSP_H
+
+#include <stdint.h>
+
+// Quantidade de blocos na média móvel do RMS (potência de 2).
+#define MIC_MEDIA_BLOCOS 8
+
+// Métricas de um bloco, em unidades do ADC (1 LSB = 3,3 V / 4096).
+typedef struct {
+  uint16_t dc;          // Nível médio do bloco (offset do microfone)
+  uint16_t rms;         // RMS com o DC removido
+  uint16_t pico;        // Maior desvio absoluto em relação ao DC
+  uint16_t media_movel; // Média do RMS nos últimos MIC_MEDIA_BLOCOS blocos
+} mic_metricas_t;
+
+// Estado da média móvel entre blocos.
+typedef struct {
+  uint16_t historico[MIC_MEDIA_BLOCOS];
+  uint32_t soma;
+  uint8_t indice;
+  uint8_t preenchidos;
+} mic_dsp_t;
+
+void mic_dsp_init(mic_dsp_t *dsp);
+void mic_dsp_processar(mic_dsp_t *dsp, const uint16_t *amostras, uint32_t n, mic_metricas_t *saida);
+uint32_t mic_isqrt(uint64_t x);
+
+#endif
@@ -0,0 +1,159 @@
+#include <math.h>
+#include "mic_fft.h"
+#include "mic_dsp.h"
+
+// Magnitude (log2) a partir da qual a coluna acende o primeiro LED.
+// Um seno de amplitude A (em LSB do ADC) dá magnitude ~4A no bin, então 2^8 ~ A = 64.
+#define ESPECTRO_LIMIAR_LOG2 8
+
+// Fatores de giro e janela de Hann em Q15, gerados uma vez na inicialização.
+static int16_t cos_q15[FFT_N / 2];
+static int16_t sin_q15[FFT_N / 2];
+static int16_t janela_q15[FFT_N];
+static bool tabelas_geradas = false;
+
+static int16_t para_q15(float v) {
+  int32_t q = (int32_t)lroundf(v * 32768.f);
+  if (q > 32767) q = 32767;
+  if (q < -32768) q = -32768;
+  return (int16_t)q;
+}
+
+static void gerar_tabelas() {
+  for (uint32_t k = 0; k < FFT_N / 2; ++k) {
+    cos_q15[k] = para_q15(cosf(2.f * (float)M_PI * k / FFT_N));
+    sin_q15[k] = para_q15(sinf(2.f * (float)M_PI * k / FFT_N));
+  }
+  for (uint32_t i = 0; i < FFT_N; ++i)
+    janela_q15[i] = para_q15(0.5f - 0.5f * cosf(2.f * (float)M_PI * i / FFT_N));
+  tabelas_geradas = true;
+}
+
+/**
+ * FFT radix-2 in-place (decimação no tempo) em Q15.
+ * Cada estágio divide o resultado por 2, então a saída vale X[k] / FFT_N e nunca estoura:
+ * com |giro| <= 1, a magnitude complexa de cada borboleta fica limitada à da entrada.
+ */
+void fft_q15(int16_t *re, int16_t *im) {
+  // Reordenação por bits invertidos.
+  for (uint32_t i = 1, j = 0; i < FFT_N; ++i) {
+    uint32_t bit = FFT_N >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+
+    if (i < j) {
+      int16_t t = re[i]; re[i] = re[j]; re[j] = t;
+      t = im[i]; im[i] = im[j]; im[j] = t;
+    }
+  }
+
+  for (uint32_t tam = 2, passo = FFT_N / 2; tam <= FFT_N; tam <<= 1, passo >>= 1) {
+    uint32_t meio = tam >> 1;
+
+    for (uint32_t k = 0; k < meio; ++k) {
+      int32_t wr = cos_q15[k * passo];
+      int32_t wi = -sin_q15[k * passo];
+
+      for (uint32_t i = k; i < FFT_N; i += tam) {
+        uint32_t j = i + meio;
+        int32_t tr = (wr * re[j] - wi * im[j]) >> 15;
+        int32_t ti = (wr * im[j] + wi * re[j]) >> 15;
+        int32_t ur = re[i], ui = im[i];
+
+        re[i] = (int16_t)((ur + tr) >> 1);
+        im[i] = (int16_t)((ui + ti) >> 1);
+        re[j] = (int16_t)((ur - tr) >> 1);
+        im[j] = (int16_t)((ui - ti) >> 1);
+      }
+    }
+  }
+}
+
+/**
+ * Prepara o analisador para uma taxa de amostragem: as faixas cobrem de f_min_hz até
+ * a frequência de Nyquist com limites em progressão geométrica (escala logarítmica).
+ */
+void espectro_init(espectro_t *e, uint32_t taxa_hz, uint32_t f_min_hz) {
+  if (!tabelas_geradas) gerar_tabelas();
+
+  e->preenchidas = 0;
+  for (uint32_t b = 0; b < ESPECTRO_BANDAS; ++b)
+    e->bandas[b] = 0;
+
+  // Bin 0 é o DC e o bin 1 ainda recebe vazamento dele pela janela: começa no mínimo em 2.
+  uint32_t bin_min = (f_min_hz * FFT_N + taxa_hz - 1) / taxa_hz;
+  if (bin_min < 2) bin_min = 2;
+  uint32_t bin_max = FFT_N / 2;
+  float razao = (float)bin_max / (float)bin_min;
+
+  e->limites[0] = bin_min;
+  for (uint32_t b = 1; b <= ESPECTRO_BANDAS; ++b) {
+    uint32_t k = (uint32_t)lroundf(bin_min * powf(razao, (float)b / ESPECTRO_BANDAS));
+    if (k <= e->limites[b - 1]) k = e->limites[b - 1] + 1; // Toda faixa tem ao menos um bin
+    e->limites[b] = k;
+  }
+}
+
+/**
+ * Copia amostras do ADC (12 bits) para a janela em acumulação.
+ * Retorna quantas foram usadas; a janela está pronta quando preenchidas == FFT_N.
+ */
+uint32_t espectro_alimentar(espectro_t *e, const uint16_t *amostras, uint32_t n) {
+  uint32_t livres = FFT_N - e->preenchidas;
+  if (n > livres) n = livres;
+
+  for (uint32_t i = 0; i < n; ++i)
+    e->entrada[e->preenchidas + i] = (int16_t)((amostras[i] & 0x0FFF) - 2048);
+
+  e->preenchidas += n;
+  return n;
+}
+
+/**
+ * Remove o DC da janela, aplica Hann, calcula a FFT e guarda o maior bin de cada faixa.
+ */
+void espectro_calcular(espectro_t *e) {
+  static int16_t re[FFT_N], im[FFT_N];
+
+  int32_t soma = 0;
+  for (uint32_t i = 0; i < FFT_N; ++i)
+    soma += e->entrada[i];
+  int32_t dc = soma >> FFT_LOG2_N;
+
+  // Q11 -> Q15 (x16) e janela.
+  for (uint32_t i = 0; i < FFT_N; ++i) {
+    int32_t x = (e->entrada[i] - dc) << 4;
+    if (x > 32767) x = 32767;
+    if (x < -32768) x = -32768;
+    re[i] = (int16_t)((x * janela_q15[i]) >> 15);
+    im[i] = 0;
+  }
+
+  fft_q15(re, im);
+
+  for (uint32_t b = 0; b < ESPECTRO_BANDAS; ++b) {
+    uint32_t maior = 0;
+    for (uint32_t k = e->limites[b]; k < e->limites[b + 1] && k < FFT_N / 2; ++k) {
+      uint32_t p = (uint32_t)(re[k] * re[k]) + (uint32_t)(im[k] * im[k]);
+      if (p > maior) maior = p;
+    }
+    e->bandas[b] = (uint16_t)mic_isqrt(maior);
+  }
+
+  e->preenchidas = 0;
+}
+
+/**
+ * Altura da coluna (0 a max_altura) em escala logarítmica: um LED a mais a cada 6 dB.
+ */
+uint8_t espectro_altura(uint16_t magnitude, uint8_t max_altura) {
+  if (magnitude == 0) return 0;
+
+  int32_t log2 = 31 - __builtin_clz(magnitude);
+  int32_t altura = log2 - ESPECTRO_LIMIAR_LOG2 + 1;
+
+  if (altura < 0) altura = 0;
+  if (altura > max_altura) altura = max_altura;
+  return (uint8_t)altura;
+}
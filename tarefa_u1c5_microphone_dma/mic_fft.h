@@ -0,0 +1,27 @@
+#ifndef MIC_FFT_H
+#define MIC_FFT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Tamanho da FFT (potência de 2) e número de faixas do analisador (uma por coluna).
+#define FFT_LOG2_N 8
+#define FFT_N (1 << FFT_LOG2_N)
+#define ESPECTRO_BANDAS 5
+
+// Janela em acumulação e resultado da última FFT.
+typedef struct {
+  int16_t entrada[FFT_N];             // Amostras centradas (Q11, sem DC)
+  uint16_t preenchidas;
+  uint16_t limites[ESPECTRO_BANDAS + 1]; // Bin inicial de cada faixa (espaçamento logarítmico)
+  uint16_t bandas[ESPECTRO_BANDAS];   // Maior magnitude de cada faixa
+} espectro_t;
+
+void fft_q15(int16_t *re, int16_t *im);
+
+void espectro_init(espectro_t *e, uint32_t taxa_hz, uint32_t f_min_hz);
+uint32_t espectro_alimentar(espectro_t *e, const uint16_t *amostras, uint32_t n);
+void espectro_calcular(espectro_t *e);
+uint8_t espectro_altura(uint16_t magnitude, uint8_t max_altura);
+
+#endif
@@ -1,8 +1,11 @@
 #include <stdio.h>
-#include <math.h>
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
 #include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "mic_dsp.h"
+#include "mic_fft.h"
 #include "neopixel.c"
 
 // Pino e canal do microfone no ADC.
@@ -11,27 +14,45 @@
 
 // Parâmetros e macros do ADC.
 #define ADC_CLOCK_DIV 96.f
-#define SAMPLES 200 // Número de amostras que serão feitas do ADC.
-#define ADC_ADJUST(x) (x * 3.3f / (1 << 12u) - 1.65f) // Ajuste do valor do ADC para Volts.
+#define SAMPLES 200 // Número de amostras em cada bloco do ping-pong.
 #define ADC_MAX 3.3f
 #define ADC_STEP (3.3f/5.f) // Intervalos de volume do microfone.
 
+// Modo analisador de espectro: taxa menor para que os bins da FFT caiam na faixa de áudio.
+// O ADC leva (1 + div) ciclos de 48 MHz por conversão.
+#define TAXA_ESPECTRO_HZ 20000
+#define ADC_CLOCK_DIV_ESPECTRO (48000000.f / TAXA_ESPECTRO_HZ - 1.f)
+#define ESPECTRO_F_MIN_HZ 150 // Início da primeira faixa (coluna da esquerda).
+
+// Botão A alterna entre medidor de volume e analisador de espectro.
+#define BUTTON_A 5
+#define DEBOUNCE_US 200000
+
+// Intervalo entre os relatórios na serial (os blocos chegam muito mais rápido).
+#define INTERVALO_RELATORIO_US 100000
+
 // Pino e número de LEDs da matriz de LEDs.
 #define LED_PIN 7
 #define LED_COUNT 25
+#define NUM_COLUNAS 5
+#define NUM_LINHAS 5
 
-#define abs(x) ((x < 0) ? (-x) : (x))
+// Dois canais DMA encadeados: enquanto um enche seu buffer, o outro já foi entregue ao
+// processamento. O ADC nunca para, então não há lacuna entre blocos.
+uint dma_channel[2];
+dma_channel_config dma_cfg[2];
 
-// Canal e configurações do DMA
-uint dma_channel;
-dma_channel_config dma_cfg;
+// Buffers de amostras do ADC (ping-pong).
+uint16_t adc_buffer[2][SAMPLES];
 
-// Buffer de amostras do ADC.
-uint16_t adc_buffer[SAMPLES];
+// Preenchidos no handler do DMA: último buffer completo e total de blocos capturados.
+volatile uint8_t bloco_pronto = 0;
+volatile uint32_t blocos_capturados = 0;
 
-void sample_mic();
-float mic_power();
-uint8_t get_intensity(float v);
+void start_mic_stream();
+void set_mode(bool espectro, espectro_t *esp);
+void draw_spectrum(const espectro_t *esp);
+uint8_t get_intensity(uint16_t rms);
 
 int main() {
   stdio_init_all();
@@ -65,157 +86,287 @@ int main() {
 
   printf("Preparando DMA...");
 
-  // Tomando posse de canal do DMA.
-  dma_channel = dma_claim_unused_channel(true);
+  // Tomando posse de dois canais do DMA.
+  dma_channel[0] = dma_claim_unused_channel(true);
+  dma_channel[1] = dma_claim_unused_channel(true);
 
-  // Configurações do DMA.
-  dma_cfg = dma_channel_get_default_config(dma_channel);
+  // Configurações do DMA: iguais nos dois canais, exceto o encadeamento cruzado.
+  for (uint i = 0; i < 2; ++i) {
+    dma_cfg[i] = dma_channel_get_default_config(dma_channel[i]);
 
-  channel_config_set_transfer_data_size(&dma_cfg, DMA_SIZE_16); // Tamanho da transferência é 16-bits (usamos uint16_t para armazenar valores do ADC)
-  channel_config_set_read_increment(&dma_cfg, false); // Desabilita incremento do ponteiro de leitura (lemos de um único registrador)
-  channel_config_set_write_increment(&dma_cfg, true); // Habilita incremento do ponteiro de escrita (escrevemos em um array/buffer)
-  
-  channel_config_set_dreq(&dma_cfg, DREQ_ADC); // Usamos a requisição de dados do ADC
+    channel_config_set_transfer_data_size(&dma_cfg[i], DMA_SIZE_16); // Tamanho da transferência é 16-bits (usamos uint16_t para armazenar valores do ADC)
+    channel_config_set_read_increment(&dma_cfg[i], false); // Desabilita incremento do ponteiro de leitura (lemos de um único registrador)
+    channel_config_set_write_increment(&dma_cfg[i], true); // Habilita incremento do ponteiro de escrita (escrevemos em um array/buffer)
+
+    channel_config_set_dreq(&dma_cfg[i], DREQ_ADC); // Usamos a requisição de dados do ADC
+    channel_config_set_chain_to(&dma_cfg[i], dma_channel[1 - i]); // Ao terminar, dispara o outro canal
+  }
 
-  // Amostragem de teste.
-  printf("Amostragem de teste...\n");
-  sample_mic();
+  // Botão de troca de modo.
+  gpio_init(BUTTON_A);
+  gpio_set_dir(BUTTON_A, GPIO_IN);
+  gpio_pull_up(BUTTON_A);
 
+  // Inicia a captura contínua.
+  printf("Iniciando captura continua...\n");
+  start_mic_stream();
 
   printf("Configuracoes completas!\n");
 
+  mic_dsp_t dsp;
+  mic_dsp_init(&dsp);
+
+  espectro_t esp;
+  espectro_init(&esp, TAXA_ESPECTRO_HZ, ESPECTRO_F_MIN_HZ);
+
+  bool modo_espectro = false;
+  bool botao_anterior = false;
+  uint64_t ultimo_toque = 0;
+
+  mic_metricas_t metricas = {0};
+  uint32_t blocos_processados = blocos_capturados;
+  uint32_t blocos_perdidos = 0;
+  uint32_t custo_us = 0;
+  uint32_t custo_fft_us = 0;
+  uint8_t ultima_intensidade = 0xFF;
+  uint64_t proximo_relatorio = time_us_64();
+
   printf("\n----\nIniciando loop...\n----\n");
   while (true) {
 
-    // Realiza uma amostragem do microfone.
-    sample_mic();
-
-    // Pega a potência média da amostragem do microfone.
-    float avg = mic_power();
-    avg = 2.f * abs(ADC_ADJUST(avg)); // Ajusta para intervalo de 0 a 3.3V. (apenas magnitude, sem sinal)
-
-    uint intensity = get_intensity(avg); // Calcula intensidade a ser mostrada na matriz de LEDs.
-
-    // Limpa a matriz de LEDs.
-    npClear();
-
-    // A depender da intensidade do som, acende LEDs específicos.
-    switch (intensity) {
-      case 0: break; // Se o som for muito baixo, não acende nada.
-      case 1:
-        npSetLED(12, 0, 0, 80); // Acende apenas o centro.
-        break;
-      case 2:
-        npSetLED(12, 0, 0, 120); // Acente o centro.
-
-        // Primeiro anel.
-        npSetLED(7, 0, 0, 80);
-        npSetLED(11, 0, 0, 80);
-        npSetLED(13, 0, 0, 80);
-        npSetLED(17, 0, 0, 80);
-        break;
-      case 3:
-        // Centro.
-        npSetLED(12, 60, 60, 0);
-
-        // Primeiro anel.
-        npSetLED(7, 0, 0, 120);
-        npSetLED(11, 0, 0, 120);
-        npSetLED(13, 0, 0, 120);
-        npSetLED(17, 0, 0, 120);
-
-        // Segundo anel.
-        npSetLED(2, 0, 0, 80);
-        npSetLED(6, 0, 0, 80);
-        npSetLED(8, 0, 0, 80);
-        npSetLED(10, 0, 0, 80);
-        npSetLED(14, 0, 0, 80);
-        npSetLED(16, 0, 0, 80);
-        npSetLED(18, 0, 0, 80);
-        npSetLED(22, 0, 0, 80);
-        break;
-      case 4:
-        // Centro.
-        npSetLED(12, 80, 0, 0);
-
-        // Primeiro anel.
-        npSetLED(7, 60, 60, 0);
-        npSetLED(11, 60, 60, 0);
-        npSetLED(13, 60, 60, 0);
-        npSetLED(17, 60, 60, 0);
-
-        // Segundo anel.
-        npSetLED(2, 0, 0, 120);
-        npSetLED(6, 0, 0, 120);
-        npSetLED(8, 0, 0, 120);
-        npSetLED(10, 0, 0, 120);
-        npSetLED(14, 0, 0, 120);
-        npSetLED(16, 0, 0, 120);
-        npSetLED(18, 0, 0, 120);
-        npSetLED(22, 0, 0, 120);
-
-        // Terceiro anel.
-        npSetLED(1, 0, 0, 80);
-        npSetLED(3, 0, 0, 80);
-        npSetLED(5, 0, 0, 80);
-        npSetLED(9, 0, 0, 80);
-        npSetLED(15, 0, 0, 80);
-        npSetLED(19, 0, 0, 80);
-        npSetLED(21, 0, 0, 80);
-        npSetLED(23, 0, 0, 80);
-        break;
+    // Dorme até o DMA entregar um novo bloco.
+    while (blocos_capturados == blocos_processados)
+      __wfi();
+
+    // Se o processamento atrasou mais de um bloco, os intermediários já foram sobrescritos.
+    uint32_t capturados = blocos_capturados;
+    if (capturados - blocos_processados > 1)
+      blocos_perdidos += capturados - blocos_processados - 1;
+    blocos_processados = capturados;
+
+    // Botão A (com debounce) troca o modo e a taxa do ADC.
+    bool botao = !gpio_get(BUTTON_A);
+    if (botao && !botao_anterior && time_us_64() - ultimo_toque > DEBOUNCE_US) {
+      ultimo_toque = time_us_64();
+      modo_espectro = !modo_espectro;
+      set_mode(modo_espectro, &esp);
+      ultima_intensidade = 0xFF; // Força redesenho ao voltar para o medidor de volume.
+    }
+    botao_anterior = botao;
+
+    // Processa o buffer completo enquanto o outro canal enche o seu.
+    const uint16_t *bloco = adc_buffer[bloco_pronto];
+    uint32_t inicio = time_us_32();
+    mic_dsp_processar(&dsp, bloco, SAMPLES, &metricas);
+    custo_us = time_us_32() - inicio;
+
+    // No modo espectro, o bloco também alimenta a janela da FFT (uma FFT a cada FFT_N amostras).
+    bool espectro_novo = false;
+    if (modo_espectro) {
+      uint32_t usadas = 0;
+      while (usadas < SAMPLES) {
+        usadas += espectro_alimentar(&esp, bloco + usadas, SAMPLES - usadas);
+        if (esp.preenchidas == FFT_N) {
+          inicio = time_us_32();
+          espectro_calcular(&esp);
+          custo_fft_us = time_us_32() - inicio;
+          espectro_novo = true;
+        }
+      }
+    }
+
+    // Um bloco só vale se o DMA não voltou a escrever nele durante o processamento.
+    if (blocos_capturados - capturados > 1)
+      ++blocos_perdidos;
+
+    uint8_t intensity = get_intensity(metricas.media_movel); // Calcula intensidade a ser mostrada na matriz de LEDs.
+
+    // Espectro: cada faixa vira uma coluna. Um quadro perdido por DMA ocupado é coberto pela próxima FFT.
+    if (espectro_novo && !npBusy()) {
+      draw_spectrum(&esp);
+      npWriteAsync();
     }
-    // Atualiza a matriz.
-    npWrite();
 
-    // Envia a intensidade e a média das leituras do ADC por serial.
-    printf("%2d %8.4f\r", intensity, avg);
+    // Volume: só redesenha a matriz quando o nível muda e o quadro anterior já foi enviado.
+    if (!modo_espectro && intensity != ultima_intensidade && !npBusy()) {
+      ultima_intensidade = intensity;
+
+      // Limpa a matriz de LEDs.
+      npClear();
+
+      // A depender da intensidade do som, acende LEDs específicos.
+      switch (intensity) {
+        case 0: break; // Se o som for muito baixo, não acende nada.
+        case 1:
+          npSetLED(12, 0, 0, 80); // Acende apenas o centro.
+          break;
+        case 2:
+          npSetLED(12, 0, 0, 120); // Acente o centro.
+
+          // Primeiro anel.
+          npSetLED(7, 0, 0, 80);
+          npSetLED(11, 0, 0, 80);
+          npSetLED(13, 0, 0, 80);
+          npSetLED(17, 0, 0, 80);
+          break;
+        case 3:
+          // Centro.
+          npSetLED(12, 60, 60, 0);
+
+          // Primeiro anel.
+          npSetLED(7, 0, 0, 120);
+          npSetLED(11, 0, 0, 120);
+          npSetLED(13, 0, 0, 120);
+          npSetLED(17, 0, 0, 120);
+
+          // Segundo anel.
+          npSetLED(2, 0, 0, 80);
+          npSetLED(6, 0, 0, 80);
+          npSetLED(8, 0, 0, 80);
+          npSetLED(10, 0, 0, 80);
+          npSetLED(14, 0, 0, 80);
+          npSetLED(16, 0, 0, 80);
+          npSetLED(18, 0, 0, 80);
+          npSetLED(22, 0, 0, 80);
+          break;
+        case 4:
+          // Centro.
+          npSetLED(12, 80, 0, 0);
+
+          // Primeiro anel.
+          npSetLED(7, 60, 60, 0);
+          npSetLED(11, 60, 60, 0);
+          npSetLED(13, 60, 60, 0);
+          npSetLED(17, 60, 60, 0);
+
+          // Segundo anel.
+          npSetLED(2, 0, 0, 120);
+          npSetLED(6, 0, 0, 120);
+          npSetLED(8, 0, 0, 120);
+          npSetLED(10, 0, 0, 120);
+          npSetLED(14, 0, 0, 120);
+          npSetLED(16, 0, 0, 120);
+          npSetLED(18, 0, 0, 120);
+          npSetLED(22, 0, 0, 120);
+
+          // Terceiro anel.
+          npSetLED(1, 0, 0, 80);
+          npSetLED(3, 0, 0, 80);
+          npSetLED(5, 0, 0, 80);
+          npSetLED(9, 0, 0, 80);
+          npSetLED(15, 0, 0, 80);
+          npSetLED(19, 0, 0, 80);
+          npSetLED(21, 0, 0, 80);
+          npSetLED(23, 0, 0, 80);
+          break;
+      }
+      // Atualiza a matriz via DMA; a captura e o DSP seguem enquanto o quadro é enviado.
+      npWriteAsync();
+    }
+
+    // Envia intensidade, métricas (em unidades do ADC), custo do bloco e perdas pela serial.
+    if (time_us_64() >= proximo_relatorio) {
+      proximo_relatorio += INTERVALO_RELATORIO_US;
+      if (modo_espectro) {
+        printf("esp %5u %5u %5u %5u %5u | fft %4lu us | perdidos %lu\r",
+               esp.bandas[0], esp.bandas[1], esp.bandas[2], esp.bandas[3], esp.bandas[4],
+               (unsigned long)custo_fft_us, (unsigned long)blocos_perdidos);
+      } else {
+          printf("%2d rms %4u pico %4u media %4u dc %4u | %3lu us/bloco | perdidos %lu\r",
+               intensity, metricas.rms, metricas.pico, metricas.media_movel, metricas.dc,
+               (unsigned long)custo_us, (unsigned long)blocos_perdidos);
+      }
+    }
   }
 }
 
 /**
- * Realiza as leituras do ADC e armazena os valores no buffer.
+ * Handler do DMA: rearma o buffer do canal que terminou (o outro já foi disparado pelo
+ * encadeamento) e o entrega ao processamento.
  */
-void sample_mic() {
+void mic_dma_handler() {
+  for (uint i = 0; i < 2; ++i) {
+    if (dma_channel_get_irq0_status(dma_channel[i])) {
+      dma_channel_acknowledge_irq0(dma_channel[i]);
+      dma_channel_set_write_addr(dma_channel[i], adc_buffer[i], false);
+      bloco_pronto = i;
+      ++blocos_capturados;
+    }
+  }
+}
+
+/**
+ * Configura os dois canais em ping-pong e liga o ADC em modo contínuo.
+ */
+void start_mic_stream() {
+  adc_run(false);
   adc_fifo_drain(); // Limpa o FIFO do ADC.
-  adc_run(false); // Desliga o ADC (se estiver ligado) para configurar o DMA.
 
-  dma_channel_configure(dma_channel, &dma_cfg,
-    adc_buffer, // Escreve no buffer.
-    &(adc_hw->fifo), // Lê do ADC.
-    SAMPLES, // Faz SAMPLES amostras.
-    true // Liga o DMA.
-  );
+  for (uint i = 0; i < 2; ++i) {
+    dma_channel_configure(dma_channel[i], &dma_cfg[i],
+      adc_buffer[i], // Escreve no buffer deste canal.
+      &(adc_hw->fifo), // Lê do ADC.
+      SAMPLES, // Faz SAMPLES amostras por bloco.
+      false // Só o primeiro canal é disparado manualmente.
+    );
+    dma_channel_set_irq0_enabled(dma_channel[i], true);
+  }
+
+  irq_add_shared_handler(DMA_IRQ_0, mic_dma_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_0, true);
 
-  // Liga o ADC e espera acabar a leitura.
+  dma_channel_start(dma_channel[0]);
   adc_run(true);
-  dma_channel_wait_for_finish_blocking(dma_channel);
-  
-  // Acabou a leitura, desliga o ADC de novo.
-  adc_run(false);
 }
 
 /**
- * Calcula a potência média das leituras do ADC. (Valor RMS)
+ * Alterna o modo: o espectro usa TAXA_ESPECTRO_HZ, o medidor de volume a taxa original.
+ * O ping-pong continua rodando; só o divisor do ADC muda.
  */
-float mic_power() {
-  float avg = 0.f;
+void set_mode(bool espectro, espectro_t *esp) {
+  adc_set_clkdiv(espectro ? ADC_CLOCK_DIV_ESPECTRO : ADC_CLOCK_DIV);
+  espectro_init(esp, TAXA_ESPECTRO_HZ, ESPECTRO_F_MIN_HZ);
+}
 
-  for (uint i = 0; i < SAMPLES; ++i)
-    avg += adc_buffer[i] * adc_buffer[i];
-  
-  avg /= SAMPLES;
-  return sqrt(avg);
+/**
+ * Índice na fita da posição (x, y) da matriz, com (0, 0) no canto superior esquerdo.
+ * A fita começa no canto inferior direito e segue em serpentina.
+ */
+static uint led_index(uint x, uint y) {
+  uint linha_fisica = NUM_LINHAS - 1 - y;
+  uint base = linha_fisica * NUM_COLUNAS;
+  return (linha_fisica % 2 == 0) ? base + (NUM_COLUNAS - 1 - x) : base + x;
 }
 
 /**
- * Calcula a intensidade do volume registrado no microfone, de 0 a 4, usando a tensão.
+ * Desenha o espectro: a faixa mais grave à esquerda, colunas crescendo de baixo para cima
+ * com as mesmas cores do medidor de volume (azul, depois amarelo, vermelho no topo).
  */
-uint8_t get_intensity(float v) {
-  uint count = 0;
+void draw_spectrum(const espectro_t *esp) {
+  npClear();
+
+  for (uint x = 0; x < NUM_COLUNAS; ++x) {
+    uint altura = espectro_altura(esp->bandas[x], NUM_LINHAS);
+
+    for (uint h = 0; h < altura; ++h) {
+      uint y = NUM_LINHAS - 1 - h;
+      if (h >= 4)
+        npSetLED(led_index(x, y), 80, 0, 0);
+      else if (h >= 2)
+        npSetLED(led_index(x, y), 60, 60, 0);
+      else
+        npSetLED(led_index(x, y), 0, 0, 120);
+    }
+  }
+}
 
-  while ((v -= ADC_STEP/20) > 0.f)
-    ++count;
+/**
+ * Calcula a intensidade do volume registrado no microfone, de 0 a 4, a partir do RMS
+ * (sem DC) em unidades do ADC. Cada degrau vale ADC_STEP/20 no dobro da amplitude RMS,
+ * ou seja, rms * 2 * ADC_MAX / 4096 / (ADC_STEP / 20) = rms * 200 / 4096.
+ */
+uint8_t get_intensity(uint16_t rms) {
+  uint count = ((uint32_t)rms * 200u) >> 12;
   
-  return count;
+  return count > 4 ? 4 : count;
 }
@@ -3,6 +3,12 @@
 
 #include <stdlib.h>
 #include "ws2818b.pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// Tempo entre o fim do DMA e o próximo quadro: esvaziar o FIFO do PIO
+// (8 palavras x 30 us) mais o sinal de RESET do datasheet (>= 100 us).
+#define NP_TEMPO_LATCH_US 400
 
 // Definição de pixel GRB
 struct pixel_t {
@@ -20,6 +26,31 @@ static uint led_count;
 static PIO np_pio;
 static uint np_sm;
 
+// Quadro empacotado (uma palavra GRB de 24 bits por LED) e estado do envio por DMA.
+static uint32_t *np_quadro;
+static int np_dma_chan = -1;
+static volatile bool np_dma_ocupado = false;
+static volatile uint64_t np_fim_envio_us = 0;
+
+/**
+ * Monta a palavra lida pelo PIO (deslocamento à direita, 24 bits): G sai primeiro, depois R e B.
+ */
+static inline uint32_t npPack(const npLED_t *led) {
+  return (uint32_t)led->G | ((uint32_t)led->R << 8) | ((uint32_t)led->B << 16);
+}
+
+/**
+ * Handler do DMA_IRQ_1: registra o fim da transferência do quadro.
+ */
+static void npDmaHandler() {
+  if (np_dma_chan < 0 || !dma_channel_get_irq1_status(np_dma_chan))
+    return;
+
+  dma_channel_acknowledge_irq1(np_dma_chan);
+  np_fim_envio_us = time_us_64();
+  np_dma_ocupado = false;
+}
+
 /**
  * Inicializa a máquina PIO para controle da matriz de LEDs.
  */
@@ -42,6 +73,21 @@ void npInit(uint pin, uint amount) {
   // Inicia programa na máquina PIO obtida.
   ws2818b_program_init(np_pio, np_sm, offset, pin, 800000.f);
 
+  // Canal DMA que alimenta o FIFO TX do PIO no ritmo do DREQ da máquina.
+  np_quadro = (uint32_t *)calloc(led_count, sizeof(uint32_t));
+  np_dma_chan = dma_claim_unused_channel(true);
+
+  dma_channel_config cfg = dma_channel_get_default_config(np_dma_chan);
+  channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+  channel_config_set_read_increment(&cfg, true);
+  channel_config_set_write_increment(&cfg, false);
+  channel_config_set_dreq(&cfg, pio_get_dreq(np_pio, np_sm, true));
+  dma_channel_configure(np_dma_chan, &cfg, &np_pio->txf[np_sm], np_quadro, led_count, false);
+
+  dma_channel_set_irq1_enabled(np_dma_chan, true);
+  irq_add_shared_handler(DMA_IRQ_1, npDmaHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+  irq_set_enabled(DMA_IRQ_1, true);
+
   // Limpa buffer de pixels.
   for (uint i = 0; i < led_count; ++i) {
     leds[i].R = 0;
@@ -67,17 +113,44 @@ void npClear() {
     npSetLED(i, 0, 0, 0);
 }
 
+/**
+ * Indica se ainda há um quadro sendo transmitido (DMA ativo ou aguardando o RESET).
+ */
+bool npBusy() {
+  if (np_dma_ocupado)
+    return true;
+  return (time_us_64() - np_fim_envio_us) < NP_TEMPO_LATCH_US;
+}
+
 /**
  * Escreve os dados do buffer nos LEDs.
  */
 void npWrite() {
-  // Escreve cada dado de 8-bits dos pixels em sequência no buffer da máquina PIO.
-  for (uint i = 0; i < led_count; ++i) {
-    pio_sm_put_blocking(np_pio, np_sm, leds[i].G);
-    pio_sm_put_blocking(np_pio, np_sm, leds[i].R);
-    pio_sm_put_blocking(np_pio, np_sm, leds[i].B);
-  }
+  while (npBusy())
+    tight_loop_contents();
+
+  // Escreve uma palavra GRB por pixel no buffer da máquina PIO.
+  for (uint i = 0; i < led_count; ++i)
+    pio_sm_put_blocking(np_pio, np_sm, npPack(&leds[i]));
+
   sleep_us(100); // Espera 100us, sinal de RESET do datasheet.
+  np_fim_envio_us = time_us_64();
+}
+
+/**
+ * Envia o buffer aos LEDs via DMA, sem bloquear a CPU.
+ * Retorna false (e descarta o quadro) se o anterior ainda está em andamento.
+ */
+bool npWriteAsync() {
+  if (npBusy())
+    return false;
+
+  for (uint i = 0; i < led_count; ++i)
+    np_quadro[i] = npPack(&leds[i]);
+
+  np_dma_ocupado = true;
+  dma_channel_transfer_from_buffer_now(np_dma_chan, np_quadro, led_count);
+  return true;
 }
 
 #endif
\ No newline at end of file
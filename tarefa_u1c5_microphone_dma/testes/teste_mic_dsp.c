@@ -0,0 +1,213 @@
+/**
+ * teste_mic_dsp.c
+ *
+ * Compara o RMS, o DC e o pico inteiros de mic_dsp_processar() com o cálculo em
+ * double, numa varredura de amplitude, frequência e offset, e confere a média móvel.
+ * Com um WAV como argumento, passa o arquivo pelo mesmo código em blocos de
+ * SAMPLES amostras (como o ping-pong do microphone_dma.c) e mede o custo por bloco.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "mic_dsp.h"
+
+#define SAMPLES 200              // Bloco do microphone_dma.c
+#define TAXA_HZ 20000.0
+#define BLOCOS_BANCADA 2000
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static double agora_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint16_t saturar_12(double v) {
+    long q = lround(v);
+    if (q < 0) q = 0;
+    if (q > 4095) q = 4095;
+    return (uint16_t)q;
+}
+
+// Referência em double sobre as mesmas amostras quantizadas.
+static void referencia(const uint16_t *x, uint32_t n, double *dc, double *rms, double *pico) {
+    double soma = 0, soma2 = 0;
+    for (uint32_t i = 0; i < n; ++i) soma += x[i];
+    *dc = soma / n;
+    *pico = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        double d = x[i] - *dc;
+        soma2 += d * d;
+        if (fabs(d) > *pico) *pico = fabs(d);
+    }
+    *rms = sqrt(soma2 / n);
+}
+
+static void testar_varredura(void) {
+    static const double amplitudes[] = { 0, 1, 5, 30, 200, 900, 2000 };
+    static const double frequencias[] = { 100, 440, 1000, 3000, 7000 };
+    static const double offsets[] = { 1024, 1650, 2048, 3000 };
+    uint16_t bloco[SAMPLES];
+    double pior_rms = 0;
+
+    for (size_t a = 0; a < sizeof amplitudes / sizeof amplitudes[0]; ++a)
+    for (size_t f = 0; f < sizeof frequencias / sizeof frequencias[0]; ++f)
+    for (size_t o = 0; o < sizeof offsets / sizeof offsets[0]; ++o) {
+        for (uint32_t i = 0; i < SAMPLES; ++i)
+            bloco[i] = saturar_12(offsets[o] + amplitudes[a] * sin(2 * M_PI * frequencias[f] * i / TAXA_HZ));
+
+        mic_dsp_t dsp;
+        mic_metricas_t m;
+        mic_dsp_init(&dsp);
+        mic_dsp_processar(&dsp, bloco, SAMPLES, &m);
+
+        double dc, rms, pico;
+        referencia(bloco, SAMPLES, &dc, &rms, &pico);
+
+        // O RMS inteiro é truncado: fica até 1 LSB abaixo do exato. O DC também é
+        // truncado e o pico é medido em torno dele.
+        double erro = rms - m.rms;
+        if (erro > pior_rms) pior_rms = erro;
+        VERIFICAR(erro >= -1e-9 && erro < 1.0, "rms %u, ref %.3f (A=%g f=%g dc=%g)",
+                  m.rms, rms, amplitudes[a], frequencias[f], offsets[o]);
+        VERIFICAR(fabs(dc - m.dc) < 1.0, "dc %u, ref %.3f", m.dc, dc);
+        VERIFICAR(fabs(pico - m.pico) <= 1.0, "pico %u, ref %.3f", m.pico, pico);
+    }
+    printf("varredura: maior erro do RMS %.3f LSB\n", pior_rms);
+}
+
+// Raiz inteira contra floor(sqrt) em pontos próximos de quadrados perfeitos.
+static void testar_isqrt(void) {
+    for (uint64_t r = 0; r < 70000; r += 7) {
+        uint64_t q = r * r;
+        VERIFICAR(mic_isqrt(q) == r, "isqrt(%llu)", (unsigned long long)q);
+        if (q) VERIFICAR(mic_isqrt(q - 1) == r - 1, "isqrt(%llu)", (unsigned long long)(q - 1));
+    }
+    VERIFICAR(mic_isqrt(0xFFFFFFFFull * 0xFFFFFFFFull) == 0xFFFFFFFFu, "isqrt maximo");
+}
+
+// A média móvel cobre os últimos MIC_MEDIA_BLOCOS blocos, e só os já recebidos no início.
+static void testar_media_movel(void) {
+    mic_dsp_t dsp;
+    mic_metricas_t m;
+    uint16_t bloco[SAMPLES];
+    uint32_t historico[64];
+    mic_dsp_init(&dsp);
+
+    for (uint32_t b = 0; b < 40; ++b) {
+        double amp = 50 + 37 * (b % 9);
+        for (uint32_t i = 0; i < SAMPLES; ++i)
+            bloco[i] = saturar_12(2048 + amp * sin(2 * M_PI * 1000 * i / TAXA_HZ));
+        mic_dsp_processar(&dsp, bloco, SAMPLES, &m);
+        historico[b] = m.rms;
+
+        uint32_t n = b + 1 < MIC_MEDIA_BLOCOS ? b + 1 : MIC_MEDIA_BLOCOS;
+        uint32_t soma = 0;
+        for (uint32_t k = 0; k < n; ++k) soma += historico[b - k];
+        VERIFICAR(m.media_movel == soma / n, "media movel %u, esperado %u (bloco %u)",
+                  m.media_movel, soma / n, b);
+    }
+}
+
+static void bancada(const uint16_t *amostras, uint32_t blocos, const char *origem) {
+    mic_dsp_t dsp;
+    mic_metricas_t m;
+    uint32_t maior_rms = 0;
+    mic_dsp_init(&dsp);
+
+    double t0 = agora_ns();
+    for (uint32_t b = 0; b < blocos; ++b) {
+        mic_dsp_processar(&dsp, amostras + (size_t)b * SAMPLES, SAMPLES, &m);
+        if (m.rms > maior_rms) maior_rms = m.rms;
+    }
+    double ns = (agora_ns() - t0) / blocos;
+    printf("%s: %u blocos de %d, %.0f ns/bloco (%.2f ns/amostra), maior RMS %u LSB\n",
+           origem, blocos, SAMPLES, ns, ns / SAMPLES, maior_rms);
+}
+
+// Lê um WAV PCM 16 bits (primeiro canal) e converte para 12 bits com offset de 2048.
+static uint16_t *ler_wav(const char *caminho, uint32_t *n) {
+    FILE *f = fopen(caminho, "rb");
+    if (!f) return NULL;
+
+    uint8_t cab[12];
+    uint16_t canais = 0, bits = 0;
+    uint16_t *saida = NULL;
+    if (fread(cab, 1, 12, f) != 12 || memcmp(cab, "RIFF", 4) || memcmp(cab + 8, "WAVE", 4)) goto fim;
+
+    for (;;) {
+        uint8_t bloco[8];
+        if (fread(bloco, 1, 8, f) != 8) break;
+        uint32_t tam = bloco[4] | bloco[5] << 8 | bloco[6] << 16 | (uint32_t)bloco[7] << 24;
+
+        if (!memcmp(bloco, "fmt ", 4)) {
+            uint8_t fmt[16];
+            if (tam < 16 || fread(fmt, 1, 16, f) != 16) break;
+            canais = fmt[2] | fmt[3] << 8;
+            bits = fmt[14] | fmt[15] << 8;
+            fseek(f, tam - 16 + (tam & 1), SEEK_CUR);
+        } else if (!memcmp(bloco, "data", 4)) {
+            if (bits != 16 || canais == 0) break;
+            uint32_t quadros = tam / (2u * canais);
+            int16_t *pcm = malloc((size_t)tam);
+            saida = malloc((size_t)quadros * sizeof *saida);
+            if (!pcm || !saida || fread(pcm, 1, tam, f) != tam) {
+                free(pcm);
+                free(saida);
+                saida = NULL;
+                break;
+            }
+            for (uint32_t i = 0; i < quadros; ++i)
+                saida[i] = (uint16_t)((pcm[(size_t)i * canais] >> 4) + 2048);
+            free(pcm);
+            *n = quadros;
+            break;
+        } else {
+            fseek(f, tam + (tam & 1), SEEK_CUR);
+        }
+    }
+fim:
+    fclose(f);
+    return saida;
+}
+
+int main(int argc, char **argv) {
+    testar_isqrt();
+    testar_varredura();
+    testar_media_movel();
+
+    if (argc > 1) {
+        uint32_t n = 0;
+        uint16_t *wav = ler_wav(argv[1], &n);
+        if (!wav || n < SAMPLES) {
+            printf("nao foi possivel ler %s (PCM 16 bits)\n", argv[1]);
+            return 1;
+        }
+        bancada(wav, n / SAMPLES, argv[1]);
+        free(wav);
+    } else {
+        static uint16_t sintetico[BLOCOS_BANCADA * SAMPLES];
+        uint32_t semente = 1;
+        for (uint32_t i = 0; i < sizeof sintetico / sizeof sintetico[0]; ++i) {
+            semente = semente * 1103515245u + 12345u;
+            double ruido = (double)(semente >> 16 & 0xFF) - 128;
+            sintetico[i] = saturar_12(1650 + 400 * sin(2 * M_PI * 440 * i / TAXA_HZ) + ruido);
+        }
+        bancada(sintetico, BLOCOS_BANCADA, "sintetico");
+    }
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
@@ -0,0 +1,179 @@
+/**
+ * teste_mic_fft.c
+ *
+ * Confere a FFT em Q15 contra uma DFT em double (relação sinal-ruído da saída),
+ * varre senos por todos os bins do analisador verificando se o pico cai na faixa
+ * certa e mede o tempo de fft_q15() e de espectro_calcular() no host.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "mic_fft.h"
+
+#define TAXA_HZ 20000            // TAXA_ESPECTRO_HZ do microphone_dma.c
+#define F_MIN_HZ 150
+#define SNR_MINIMO_DB 40.0
+#define REPETICOES 20000
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static double agora_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// A saída de fft_q15 vale X[k] / FFT_N; a referência é dividida igual.
+static double snr_fft(const int16_t *entrada) {
+    int16_t re[FFT_N], im[FFT_N];
+    for (int i = 0; i < FFT_N; ++i) {
+        re[i] = entrada[i];
+        im[i] = 0;
+    }
+    fft_q15(re, im);
+
+    double sinal = 0, erro = 0;
+    for (int k = 0; k < FFT_N; ++k) {
+        double xr = 0, xi = 0;
+        for (int n = 0; n < FFT_N; ++n) {
+            xr += entrada[n] * cos(2 * M_PI * k * n / FFT_N);
+            xi -= entrada[n] * sin(2 * M_PI * k * n / FFT_N);
+        }
+        xr /= FFT_N;
+        xi /= FFT_N;
+        sinal += xr * xr + xi * xi;
+        erro += (re[k] - xr) * (re[k] - xr) + (im[k] - xi) * (im[k] - xi);
+    }
+    return 10 * log10(sinal / (erro > 0 ? erro : 1e-30));
+}
+
+static void testar_precisao(void) {
+    int16_t x[FFT_N];
+    uint32_t semente = 7;
+
+    // Seno cheio, dois tons e ruído em toda a escala Q15.
+    for (int i = 0; i < FFT_N; ++i)
+        x[i] = (int16_t)lround(32000 * sin(2 * M_PI * 13 * i / FFT_N));
+    double snr_seno = snr_fft(x);
+
+    for (int i = 0; i < FFT_N; ++i)
+        x[i] = (int16_t)lround(16000 * sin(2 * M_PI * 5 * i / FFT_N) + 8000 * cos(2 * M_PI * 71 * i / FFT_N));
+    double snr_tons = snr_fft(x);
+
+    for (int i = 0; i < FFT_N; ++i) {
+        semente ^= semente << 13; semente ^= semente >> 17; semente ^= semente << 5;
+        x[i] = (int16_t)(semente >> 16);
+    }
+    double snr_ruido = snr_fft(x);
+
+    printf("SNR da FFT Q15: seno %.1f dB, dois tons %.1f dB, ruido %.1f dB\n", snr_seno, snr_tons, snr_ruido);
+    VERIFICAR(snr_seno > SNR_MINIMO_DB, "SNR do seno %.1f dB", snr_seno);
+    VERIFICAR(snr_tons > SNR_MINIMO_DB, "SNR dos dois tons %.1f dB", snr_tons);
+    VERIFICAR(snr_ruido > SNR_MINIMO_DB, "SNR do ruido %.1f dB", snr_ruido);
+}
+
+static int faixa_do_bin(const espectro_t *e, uint32_t k) {
+    for (int b = 0; b < ESPECTRO_BANDAS; ++b)
+        if (k >= e->limites[b] && k < e->limites[b + 1]) return b;
+    return -1;
+}
+
+static int faixa_do_pico(const espectro_t *e) {
+    int maior = 0;
+    for (int b = 1; b < ESPECTRO_BANDAS; ++b)
+        if (e->bandas[b] > e->bandas[maior]) maior = b;
+    return maior;
+}
+
+static void alimentar_seno(espectro_t *e, double f_hz, double amplitude) {
+    uint16_t bloco[FFT_N];
+    for (int i = 0; i < FFT_N; ++i)
+        bloco[i] = (uint16_t)lround(1650 + amplitude * sin(2 * M_PI * f_hz * i / TAXA_HZ));
+    espectro_alimentar(e, bloco, FFT_N);
+    espectro_calcular(e);
+}
+
+// Varredura por bins inteiros (o pico tem de cair na faixa do bin) e por frequências
+// intermediárias (aceita a faixa de qualquer um dos dois bins vizinhos).
+static void testar_varredura(void) {
+    espectro_t e;
+    espectro_init(&e, TAXA_HZ, F_MIN_HZ);
+
+    printf("faixas (bins):");
+    for (int b = 0; b <= ESPECTRO_BANDAS; ++b) printf(" %u", e.limites[b]);
+    printf("\n");
+
+    for (uint32_t k = e.limites[0]; k < FFT_N / 2; ++k) {
+        alimentar_seno(&e, (double)k * TAXA_HZ / FFT_N, 400);
+        int esperada = faixa_do_bin(&e, k);
+        VERIFICAR(faixa_do_pico(&e) == esperada, "bin %u: pico na faixa %d, esperada %d",
+                  k, faixa_do_pico(&e), esperada);
+    }
+
+    for (double f = (e.limites[0] + 0.5) * TAXA_HZ / FFT_N; f < TAXA_HZ / 2.0 - TAXA_HZ / FFT_N; f *= 1.07) {
+        alimentar_seno(&e, f, 400);
+        uint32_t k = (uint32_t)(f * FFT_N / TAXA_HZ);
+        int obtida = faixa_do_pico(&e);
+        VERIFICAR(obtida == faixa_do_bin(&e, k) || obtida == faixa_do_bin(&e, k + 1),
+                  "%.1f Hz: pico na faixa %d", f, obtida);
+    }
+
+    // Altura: magnitude ~4A no bin, primeiro LED a partir de A ~ 64 e um LED a mais a
+    // cada dobro de amplitude (longe dos limiares, que a truncagem desloca em 1 LSB).
+    double f_bin = 16.0 * TAXA_HZ / FFT_N;
+    alimentar_seno(&e, f_bin, 90);
+    uint8_t h90 = espectro_altura(e.bandas[faixa_do_pico(&e)], 5);
+    alimentar_seno(&e, f_bin, 360);
+    uint8_t h360 = espectro_altura(e.bandas[faixa_do_pico(&e)], 5);
+    printf("altura: A=90 -> %u, A=360 -> %u\n", h90, h360);
+    VERIFICAR(h90 == 1 && h360 == 3, "alturas %u e %u", h90, h360);
+}
+
+static void bancada(void) {
+    int16_t re[FFT_N], im[FFT_N];
+    espectro_t e;
+    espectro_init(&e, TAXA_HZ, F_MIN_HZ);
+
+    double t0 = agora_ns();
+    for (int r = 0; r < REPETICOES; ++r) {
+        for (int i = 0; i < FFT_N; ++i) {
+            re[i] = (int16_t)(i * 97 + r);
+            im[i] = 0;
+        }
+        fft_q15(re, im);
+    }
+    double ns_fft = (agora_ns() - t0) / REPETICOES;
+
+    uint16_t bloco[FFT_N];
+    for (int i = 0; i < FFT_N; ++i) bloco[i] = (uint16_t)(2048 + (i * 37 % 400));
+    t0 = agora_ns();
+    for (int r = 0; r < REPETICOES; ++r) {
+        espectro_alimentar(&e, bloco, FFT_N);
+        espectro_calcular(&e);
+    }
+    double ns_espectro = (agora_ns() - t0) / REPETICOES;
+
+    printf("fft_q15 (N=%d): %.0f ns; espectro completo: %.0f ns (%.0f atualizacoes/s possiveis)\n",
+           FFT_N, ns_fft, ns_espectro, 1e9 / ns_espectro);
+}
+
+int main(void) {
+    espectro_t e;
+    espectro_init(&e, TAXA_HZ, F_MIN_HZ);   // Gera as tabelas usadas por fft_q15()
+
+    testar_precisao();
+    testar_varredura();
+    bancada();
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
@@ -0,0 +1,12 @@
+#include "bancada_brilho.h"
+
+void bancada_brilho_float(const npLED_t *origem, uint32_t *destino, unsigned n, float brilho) {
+    for (unsigned i = 0; i < n; ++i) {
+        uint8_t r = origem[i].R * brilho;
+        uint8_t g = origem[i].G * brilho;
+        uint8_t b = origem[i].B * brilho;
+        destino[3 * i] = g;
+        destino[3 * i + 1] = r;
+        destino[3 * i + 2] = b;
+    }
+}
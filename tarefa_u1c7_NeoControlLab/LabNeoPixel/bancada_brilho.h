@@ -0,0 +1,12 @@
+#ifndef BANCADA_BRILHO_H
+#define BANCADA_BRILHO_H
+
+#include <stdint.h>
+#include "neopixel_quadro.h"
+
+// Referência para as bancadas de brilho (host e placa): o empacotamento antigo de
+// npWriteComBrilho, com uma multiplicação em float por canal e G, R e B em três
+// palavras de 8 bits. 'destino' recebe 3 * n palavras.
+void bancada_brilho_float(const npLED_t *origem, uint32_t *destino, unsigned n, float brilho);
+
+#endif
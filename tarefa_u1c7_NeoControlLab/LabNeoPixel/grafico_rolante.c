@@ -0,0 +1,25 @@
+#include <string.h>
+#include "LabNeoPixel/grafico_rolante.h"
+
+void grafico_init(grafico_rolante_t *g, uint8_t *dados, uint16_t largura, uint16_t bytes_coluna) {
+    g->dados = dados;
+    g->largura = largura;
+    g->bytes_coluna = bytes_coluna;
+    g->cabeca = largura - 1;
+    memset(dados, 0, (uint32_t)largura * bytes_coluna);
+}
+
+// Rola uma coluna para a esquerda: a mais antiga é reaproveitada como a nova, limpa.
+uint8_t *grafico_nova_coluna(grafico_rolante_t *g) {
+    g->cabeca = (g->cabeca + 1 == g->largura) ? 0 : g->cabeca + 1;
+    uint8_t *coluna = &g->dados[(uint32_t)g->cabeca * g->bytes_coluna];
+    memset(coluna, 0, g->bytes_coluna);
+    return coluna;
+}
+
+// Coluna na posição de tela x (0 = mais antiga, à esquerda; largura - 1 = mais recente).
+const uint8_t *grafico_coluna(const grafico_rolante_t *g, uint16_t x) {
+    uint32_t idx = (uint32_t)g->cabeca + 1 + x;
+    if (idx >= g->largura) idx -= g->largura;
+    return &g->dados[idx * g->bytes_coluna];
+}
@@ -0,0 +1,20 @@
+#ifndef GRAFICO_ROLANTE_H
+#define GRAFICO_ROLANTE_H
+
+#include <stdint.h>
+
+// Gráfico rolante (strip chart): 'largura' colunas de 'bytes_coluna' bytes guardadas
+// coluna a coluna num buffer circular. Rolar é só avançar a cabeça e escrever a nova
+// coluna, O(linhas); a ordem da tela é resolvida na hora de desenhar.
+typedef struct {
+    uint8_t *dados;          // largura * bytes_coluna bytes, fornecidos por quem usa
+    uint16_t largura;
+    uint16_t bytes_coluna;
+    uint16_t cabeca;         // Coluna mais recente (a da direita)
+} grafico_rolante_t;
+
+void grafico_init(grafico_rolante_t *g, uint8_t *dados, uint16_t largura, uint16_t bytes_coluna);
+uint8_t *grafico_nova_coluna(grafico_rolante_t *g);
+const uint8_t *grafico_coluna(const grafico_rolante_t *g, uint16_t x);
+
+#endif
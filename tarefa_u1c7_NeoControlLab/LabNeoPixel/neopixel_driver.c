@@ -1,54 +1,88 @@
 #include "neopixel_driver.h"
+#include "neopixel_porta.h"
 #include "ws2818b.pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "pico/time.h"
+#include "pico/sync.h"
+
+// Porta do núcleo (neopixel_quadro.c) para o RP2040: PIO, DMA, relógio e trava.
 
-npLED_t leds[LED_COUNT];
 PIO np_pio;
 int sm;
+static int np_offset = -1;          // Onde npInit carregou o ws2818b no pio0
+static int np_dma_chan = -1;
+static critical_section_t np_lock;   // Protege a troca e o empacotamento entre núcleos
 
-void npInit(uint pin) {
-    uint offset = pio_add_program(pio0, &ws2818b_program);
-    np_pio = pio0;
-    sm = 0; // Usar SM 0 fixamente
-    pio_sm_claim(np_pio, sm);
-    ws2818b_program_init(np_pio, sm, offset, pin, 800000.f);
-    npClear();
+void np_trava_iniciar(void) {
+    critical_section_init(&np_lock);
 }
 
-void npWrite(void) {
-    for (uint i = 0; i < LED_COUNT; ++i) {
-        pio_sm_put_blocking(np_pio, sm, leds[i].G);
-        pio_sm_put_blocking(np_pio, sm, leds[i].R);
-        pio_sm_put_blocking(np_pio, sm, leds[i].B);
-    }
+void np_trava_entrar(void) {
+    critical_section_enter_blocking(&np_lock);
 }
 
-void npWriteComBrilho(float brilho) {
-    for (uint i = 0; i < LED_COUNT; ++i) {
-        uint8_t r = leds[i].R * brilho;
-        uint8_t g = leds[i].G * brilho;
-        uint8_t b = leds[i].B * brilho;
-        pio_sm_put_blocking(np_pio, sm, g);
-        pio_sm_put_blocking(np_pio, sm, r);
-        pio_sm_put_blocking(np_pio, sm, b);
-    }
+void np_trava_sair(void) {
+    critical_section_exit(&np_lock);
 }
 
-void npSetLED(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
-    if (index < LED_COUNT) {
-        leds[index].R = r;
-        leds[index].G = g;
-        leds[index].B = b;
-    }
+uint64_t np_porta_agora_us(void) {
+    return time_us_64();
+}
+
+void np_porta_esperar(void) {
+    tight_loop_contents();
 }
 
-void npSetAll(uint8_t r, uint8_t g, uint8_t b) {
-    for (uint i = 0; i < LED_COUNT; ++i) {
-        npSetLED(i, r, g, b);
+void np_porta_disparar(const uint32_t *palavras, unsigned n) {
+    dma_channel_transfer_from_buffer_now(np_dma_chan, palavras, n);
+}
+
+void np_porta_enviar(const uint32_t *palavras, unsigned n) {
+    for (unsigned i = 0; i < n; ++i) {
+        pio_sm_put_blocking(np_pio, sm, palavras[i]);
     }
 }
 
-void npClear(void) {
-    npSetAll(0, 0, 0);
+// Handler do DMA_IRQ_1 (compartilhado): o DMA_IRQ_0 fica livre para outros módulos.
+static void np_dma_handler(void) {
+    if (np_dma_chan < 0 || !dma_channel_get_irq1_status(np_dma_chan)) return;
+
+    dma_channel_acknowledge_irq1(np_dma_chan);
+    np_quadro_enviado();
+}
+
+static void np_dma_init(void) {
+    np_dma_chan = dma_claim_unused_channel(true);
+
+    dma_channel_config cfg = dma_channel_get_default_config(np_dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);    // Uma palavra por LED
+    channel_config_set_read_increment(&cfg, true);               // Percorre o quadro
+    channel_config_set_write_increment(&cfg, false);             // FIFO TX fixo
+    channel_config_set_dreq(&cfg, pio_get_dreq(np_pio, sm, true)); // Ritmo ditado pelo PIO
+
+    dma_channel_configure(np_dma_chan, &cfg, &np_pio->txf[sm], NULL, LED_COUNT, false);
+
+    dma_channel_set_irq1_enabled(np_dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_1, np_dma_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+}
+
+void npInit(uint pin) {
+    npPrepararDriver();
+    if (np_offset < 0) np_offset = pio_add_program(pio0, &ws2818b_program);
+    uint offset = np_offset;
+    np_pio = pio0;
+    sm = pio_claim_unused_sm(np_pio, true); // Deixa as demais SMs livres para outras fitas
+    ws2818b_program_init(np_pio, sm, offset, pin, 800000.f);
+    np_dma_init();
+    npClear();
+}
+
+// Offset do ws2818b já carregado em 'pio' por npInit, ou -1: outros modos
+// reaproveitam o programa em vez de ocupar a memória de instruções de novo.
+int npOffsetPrograma(PIO pio) {
+    return pio == pio0 ? np_offset : -1;
 }
 
 void liberar_maquina_pio(PIO pio, uint sm_id) {
@@ -57,10 +91,3 @@ void liberar_maquina_pio(PIO pio, uint sm_id) {
         pio_sm_unclaim(pio, sm_id);
     }
 }
-
-uint getLEDIndex(uint x, uint y) {
-    if (x >= NUM_COLUNAS || y >= NUM_LINHAS) return 0;
-    uint linha_fisica = NUM_LINHAS - 1 - y;
-    uint base = linha_fisica * NUM_COLUNAS;
-    return (linha_fisica % 2 == 0) ? base + (NUM_COLUNAS - 1 - x) : base + x;
-}
@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include "LabNeoPixel/neopixel_multi.h"
+#include "ws2818b.pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "pico/time.h"
+
+// Uma fita: máquina PIO, canal DMA e o trecho do framebuffer lógico que ela transmite.
+typedef struct {
+    PIO pio;
+    uint sm;
+    uint dma_chan;
+    uint16_t inicio;
+    uint16_t quantidade;
+} npFita_t;
+
+static npFita_t fitas[NP_MULTI_MAX_FITAS];
+static uint num_fitas_ativas = 0;
+
+static const npLED_t *np_multi_buffer;
+static uint np_multi_total = 0;
+static uint32_t np_multi_quadro[NP_MULTI_MAX_LEDS];
+
+static uint32_t np_multi_mascara = 0;                    // Canais DMA de todas as fitas
+static volatile uint32_t np_multi_ocupados = 0;          // Canais ainda transmitindo
+static volatile uint64_t np_multi_inicio_us = 0;
+static volatile uint64_t np_multi_fim_us = 0;
+
+// Handler compartilhado do DMA_IRQ_1: a última fita a terminar marca o fim do quadro.
+static void np_multi_dma_handler(void) {
+    bool limpou = false;
+    for (uint i = 0; i < num_fitas_ativas; ++i) {
+        uint ch = fitas[i].dma_chan;
+        if (dma_channel_get_irq1_status(ch)) {
+            dma_channel_acknowledge_irq1(ch);
+            np_multi_ocupados &= ~(1u << ch);
+            limpou = true;
+        }
+    }
+    if (limpou && np_multi_ocupados == 0) {
+        np_multi_fim_us = time_us_64();
+    }
+}
+
+// Toma uma SM livre, primeiro no pio0 e depois no pio1, carregando o programa uma vez por
+// bloco. No pio0 o programa que npInit já carregou é reaproveitado.
+static bool np_multi_claim_sm(PIO *pio, uint *sm, uint *offset) {
+    static int offsets[2] = { -1, -1 };
+    PIO blocos[2] = { pio0, pio1 };
+
+    for (uint b = 0; b < 2; ++b) {
+        int livre = pio_claim_unused_sm(blocos[b], false);
+        if (livre < 0) continue;
+
+        if (offsets[b] < 0) offsets[b] = npOffsetPrograma(blocos[b]);
+        if (offsets[b] < 0) {
+            if (!pio_can_add_program(blocos[b], &ws2818b_program)) {
+                pio_sm_unclaim(blocos[b], livre);
+                continue;
+            }
+            offsets[b] = pio_add_program(blocos[b], &ws2818b_program);
+        }
+        *pio = blocos[b];
+        *sm = livre;
+        *offset = offsets[b];
+        return true;
+    }
+    return false;
+}
+
+// Devolve as máquinas e os canais DMA das primeiras 'n' fitas (falha no meio da
+// configuração). O programa fica carregado para a próxima tentativa.
+static void np_multi_liberar(uint n) {
+    for (uint i = 0; i < n; ++i) {
+        npFita_t *f = &fitas[i];
+        dma_channel_set_irq1_enabled(f->dma_chan, false);
+        dma_channel_unclaim(f->dma_chan);
+        liberar_maquina_pio(f->pio, f->sm);
+    }
+    np_multi_mascara = 0;
+    num_fitas_ativas = 0;
+}
+
+bool npMultiInit(const uint *pinos, uint num_fitas, const npLED_t *buffer, uint total_leds) {
+    if (num_fitas == 0 || num_fitas > NP_MULTI_MAX_FITAS) return false;
+    if (total_leds > NP_MULTI_MAX_LEDS) return false;
+
+    npPrepararDriver();
+    np_multi_buffer = buffer;
+    np_multi_total = total_leds;
+
+    // Divide os LEDs em trechos consecutivos; as primeiras fitas ficam com a sobra.
+    uint16_t inicio[NP_MULTI_MAX_FITAS], quantidade[NP_MULTI_MAX_FITAS];
+    npMultiDividir(total_leds, num_fitas, inicio, quantidade);
+
+    for (uint i = 0; i < num_fitas; ++i) {
+        npFita_t *f = &fitas[i];
+        uint offset;
+        if (!np_multi_claim_sm(&f->pio, &f->sm, &offset)) {
+            np_multi_liberar(i);
+            return false;
+        }
+
+        f->inicio = inicio[i];
+        f->quantidade = quantidade[i];
+
+        ws2818b_program_init(f->pio, f->sm, offset, pinos[i], 800000.f);
+
+        int ch = dma_claim_unused_channel(false);
+        if (ch < 0) {
+            liberar_maquina_pio(f->pio, f->sm);
+            np_multi_liberar(i);
+            return false;
+        }
+        f->dma_chan = ch;
+
+        dma_channel_config cfg = dma_channel_get_default_config(f->dma_chan);
+        channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+        channel_config_set_read_increment(&cfg, true);
+        channel_config_set_write_increment(&cfg, false);
+        channel_config_set_dreq(&cfg, pio_get_dreq(f->pio, f->sm, true));
+        dma_channel_configure(f->dma_chan, &cfg, &f->pio->txf[f->sm],
+                              &np_multi_quadro[f->inicio], f->quantidade, false);
+        dma_channel_set_irq1_enabled(f->dma_chan, true);
+
+        np_multi_mascara |= 1u << f->dma_chan;
+        num_fitas_ativas = i + 1;
+    }
+
+    irq_add_shared_handler(DMA_IRQ_1, np_multi_dma_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+    return true;
+}
+
+// Verdadeiro enquanto alguma fita transmite ou ainda não travou o quadro anterior.
+bool npMultiOcupado(void) {
+    if (np_multi_ocupados) return true;
+    return (time_us_64() - np_multi_fim_us) < NP_TEMPO_LATCH_US;
+}
+
+// Publica o framebuffer lógico e dispara todas as fitas no mesmo instante. O
+// empacotamento é a troca de quadro: roda sob a trava de np_commit_frame, então
+// quem compõe em outro núcleo (sob a mesma trava) nunca é enviado pela metade.
+bool npMultiWriteAsync(void) {
+    if (num_fitas_ativas == 0 || npMultiOcupado()) return false;
+
+    npEmpacotar(np_multi_buffer, np_multi_quadro, np_multi_total);
+
+    for (uint i = 0; i < num_fitas_ativas; ++i) {
+        npFita_t *f = &fitas[i];
+        dma_channel_set_read_addr(f->dma_chan, &np_multi_quadro[f->inicio], false);
+        dma_channel_set_trans_count(f->dma_chan, f->quantidade, false);
+    }
+
+    np_multi_ocupados = np_multi_mascara;
+    np_multi_inicio_us = time_us_64();
+    dma_start_channel_mask(np_multi_mascara);
+    return true;
+}
+
+// Tempo medido entre o disparo e o fim do DMA da fita mais longa no último quadro.
+uint32_t npMultiDuracaoUltimoQuadroUs(void) {
+    if (np_multi_ocupados || np_multi_fim_us < np_multi_inicio_us) return 0;
+    return (uint32_t)(np_multi_fim_us - np_multi_inicio_us);
+}
+
+// --------------------------------------------------------------
+// Bancada: envia 'quadros' quadros seguidos pelas fitas de
+// npMultiInit e compara o fps medido (DMA da fita mais longa mais
+// a trava) com o teórico da calculadora
+// --------------------------------------------------------------
+void npMultiBancada(uint quadros) {
+    if (num_fitas_ativas == 0 || quadros == 0) return;
+
+    uint64_t soma_dma_us = 0;
+    uint64_t inicio = time_us_64();
+    for (uint q = 0; q < quadros; ++q) {
+        while (!npMultiWriteAsync()) tight_loop_contents();
+        while (np_multi_ocupados) tight_loop_contents();
+        soma_dma_us += npMultiDuracaoUltimoQuadroUs();
+    }
+    while (npMultiOcupado()) tight_loop_contents();
+    uint64_t total_us = time_us_64() - inicio;
+
+    printf("Bancada: %u LEDs em %u fita(s), %u quadros\n", np_multi_total, num_fitas_ativas, quadros);
+    printf("  DMA medio %lu us, %lu fps medidos, %lu fps teoricos\n",
+           (unsigned long)(soma_dma_us / quadros),
+           (unsigned long)(1000000ull * quadros / total_us),
+           (unsigned long)npMultiFpsMaximo(np_multi_total, num_fitas_ativas));
+}
@@ -0,0 +1,19 @@
+#ifndef NEOPIXEL_MULTI_H
+#define NEOPIXEL_MULTI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "LabNeoPixel/neopixel_driver.h"
+#include "LabNeoPixel/neopixel_vazao.h"
+
+// Modo de múltiplas fitas: o framebuffer lógico 'buffer' (total_leds LEDs) é dividido
+// em num_fitas trechos consecutivos, um por pino, transmitidos ao mesmo tempo.
+bool npMultiInit(const uint *pinos, uint num_fitas, const npLED_t *buffer, uint total_leds);
+bool npMultiWriteAsync(void);
+bool npMultiOcupado(void);
+uint32_t npMultiDuracaoUltimoQuadroUs(void);
+
+// Benchmark: fps medido com as fitas configuradas, ao lado do teórico.
+void npMultiBancada(uint quadros);
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef NEOPIXEL_PORTA_H
+#define NEOPIXEL_PORTA_H
+
+// O que o núcleo (neopixel_quadro.c) pede ao hardware. No Pico a implementação está
+// em neopixel_driver.c (critical_section, DMA, PIO e time_us_64); nos testes de host,
+// em testes/neopixel_falso.c.
+
+#include <stdint.h>
+
+// Trava entre núcleos/contextos para a troca de buffers, o empacotamento e a tabela.
+void np_trava_iniciar(void);
+void np_trava_entrar(void);
+void np_trava_sair(void);
+
+// Começa a enviar 'n' palavras GRB sem bloquear; ao terminar, a porta chama np_quadro_enviado().
+void np_porta_disparar(const uint32_t *palavras, unsigned n);
+
+// Envia 'n' palavras GRB e só retorna quando a última entrou no FIFO do PIO.
+void np_porta_enviar(const uint32_t *palavras, unsigned n);
+
+uint64_t np_porta_agora_us(void);
+
+// Um passo de espera ativa (tight_loop_contents no Pico).
+void np_porta_esperar(void);
+
+#endif
@@ -0,0 +1,292 @@
+#include "neopixel_quadro.h"
+#include "neopixel_porta.h"
+#include <string.h>
+
+// Dois quadros: um é composto pelos efeitos (back), o outro é o último publicado (front).
+static npLED_t np_buffers[2][LED_COUNT];
+static volatile uint8_t np_front = 0;
+static volatile bool np_quadro_pendente = false;
+
+npLED_t *leds = np_buffers[1];
+
+uint16_t np_mapa[NUM_LINHAS][NUM_COLUNAS];
+uint16_t np_espiral[LED_COUNT];
+const matriz_led_t np_matriz = { NUM_COLUNAS, NUM_LINHAS, &np_mapa[0][0], np_espiral };
+
+// Sinaliza que o último quadro assíncrono terminou de ser entregue ao PIO.
+volatile bool np_quadro_concluido = true;
+
+// Quadro empacotado (uma palavra GRB de 24 bits por LED) lido pelo DMA.
+static uint32_t np_quadro[LED_COUNT];
+static volatile bool np_dma_ocupado = false;
+static volatile uint64_t np_fim_envio_us = 0;
+static npCallbackQuadro_t np_callback = NULL;
+
+// Curva gama 2,8 (brilho percebido): índice = valor linear, conteúdo = valor enviado ao LED.
+static const uint8_t np_gamma[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      2,   3,   3,   3,   3,   3,   3,   3,   4,   4,   4,   4,   4,   5,   5,   5,
+      5,   6,   6,   6,   6,   7,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,
+     10,  10,  11,  11,  11,  12,  12,  13,  13,  13,  14,  14,  15,  15,  16,  16,
+     17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  24,  24,  25,
+     25,  26,  27,  27,  28,  29,  29,  30,  31,  32,  32,  33,  34,  35,  35,  36,
+     37,  38,  39,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  50,
+     51,  52,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  66,  67,  68,
+     69,  70,  72,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,
+     90,  92,  93,  95,  96,  98,  99, 101, 102, 104, 105, 107, 109, 110, 112, 114,
+    115, 117, 119, 120, 122, 124, 126, 127, 129, 131, 133, 135, 137, 138, 140, 142,
+    144, 146, 148, 150, 152, 154, 156, 158, 160, 162, 164, 167, 169, 171, 173, 175,
+    177, 180, 182, 184, 186, 189, 191, 193, 196, 198, 200, 203, 205, 208, 210, 213,
+    215, 218, 220, 223, 225, 228, 231, 233, 236, 239, 241, 244, 247, 249, 252, 255,
+};
+
+// Tabela efetiva aplicada no empacotamento: gama (opcional) seguida do brilho global.
+// Recalculada só quando o brilho ou a gama mudam; por LED resta uma consulta por canal.
+static uint8_t np_lut[256];
+static uint8_t np_brilho = 255;
+static bool np_gamma_ativo = false;
+
+static void np_atualizar_lut(void) {
+    for (unsigned v = 0; v < 256; ++v) {
+        unsigned base = np_gamma_ativo ? np_gamma[v] : v;
+        np_lut[v] = (base * (np_brilho + 1u)) >> 8;
+    }
+}
+
+// Monta a palavra no formato esperado pelo PIO (deslocamento à direita, 24 bits):
+// o byte G sai primeiro, depois R e por último B.
+static inline uint32_t np_empacotar(const npLED_t *led) {
+    return (uint32_t)np_lut[led->G] | ((uint32_t)np_lut[led->R] << 8) | ((uint32_t)np_lut[led->B] << 16);
+}
+
+// Mesma palavra com um fator extra em Q8 (256 = 1,0), aplicado por multiplicação e deslocamento.
+static inline uint32_t np_empacotar_escala(const npLED_t *led, uint32_t escala) {
+    return ((np_lut[led->G] * escala) >> 8) |
+           (((np_lut[led->R] * escala) >> 8) << 8) |
+           (((np_lut[led->B] * escala) >> 8) << 16);
+}
+
+// Empacota o quadro publicado (front); a trava impede uma troca no meio da leitura.
+static void np_empacotar_quadro(void) {
+    np_trava_entrar();
+    const npLED_t *front = np_buffers[np_front];
+    for (unsigned i = 0; i < LED_COUNT; ++i) {
+        np_quadro[i] = np_empacotar(&front[i]);
+    }
+    np_quadro_pendente = false;
+    np_trava_sair();
+}
+
+// Empacota 'n' LEDs quaisquer no formato do PIO, com a mesma tabela de gama/brilho.
+// Roda sob a trava de np_commit_frame: a tabela não muda no meio e quem compõe
+// em outro núcleo sob a mesma trava nunca tem o quadro lido pela metade.
+void npEmpacotar(const npLED_t *origem, uint32_t *destino, unsigned n) {
+    np_trava_entrar();
+    for (unsigned i = 0; i < n; ++i) {
+        destino[i] = np_empacotar(&origem[i]);
+    }
+    np_trava_sair();
+}
+
+// Fim do DMA: marca o instante para a contagem do latch e avisa quem espera.
+void np_quadro_enviado(void) {
+    np_fim_envio_us = np_porta_agora_us();
+    np_dma_ocupado = false;
+    np_quadro_concluido = true;
+
+    if (np_callback) np_callback();
+}
+
+static void np_mapa_init(void) {
+    for (unsigned y = 0; y < NUM_LINHAS; ++y) {
+        for (unsigned x = 0; x < NUM_COLUNAS; ++x) {
+            np_mapa[y][x] = NP_XY(x, y);
+        }
+    }
+}
+
+// Espiral do canto superior esquerdo ao centro, gerada para qualquer
+// NUM_COLUNAS x NUM_LINHAS: contorna a borda e fecha o retângulo a cada volta.
+static void np_espiral_init(void) {
+    int x0 = 0, y0 = 0, x1 = NUM_COLUNAS - 1, y1 = NUM_LINHAS - 1;
+    unsigned n = 0;
+
+    while (x0 <= x1 && y0 <= y1) {
+        for (int x = x0; x <= x1; ++x)                 np_espiral[n++] = np_mapa[y0][x];
+        for (int y = y0 + 1; y <= y1; ++y)             np_espiral[n++] = np_mapa[y][x1];
+        if (y0 < y1) for (int x = x1 - 1; x >= x0; --x) np_espiral[n++] = np_mapa[y1][x];
+        if (x0 < x1) for (int y = y1 - 1; y > y0; --y)  np_espiral[n++] = np_mapa[y][x0];
+        x0++; y0++; x1--; y1--;
+    }
+}
+
+// Trava, tabela de gama/brilho e mapa de coordenadas. Pode ser chamada mais de uma vez
+// (npInit e o modo de múltiplas fitas usam).
+void npPrepararDriver(void) {
+    static bool pronto = false;
+    if (pronto) return;
+    np_trava_iniciar();
+    np_atualizar_lut();
+    np_mapa_init();
+    np_espiral_init();
+    pronto = true;
+}
+
+// Devolve o back buffer, que já contém o último quadro publicado, para compor o próximo.
+npLED_t *np_begin_frame(void) {
+    return leds;
+}
+
+// Publica o back buffer como novo front de forma atômica; o novo back recebe uma cópia
+// dele para que efeitos incrementais continuem a partir do quadro publicado.
+void np_commit_frame(void) {
+    np_trava_entrar();
+    np_front ^= 1;
+    leds = np_buffers[np_front ^ 1];
+    memcpy(leds, np_buffers[np_front], sizeof(np_buffers[0]));
+    np_quadro_pendente = true;
+    np_trava_sair();
+}
+
+static void np_disparar_dma(void) {
+    np_quadro_concluido = false;
+    np_dma_ocupado = true;
+    np_porta_disparar(np_quadro, LED_COUNT);
+}
+
+static void np_iniciar_dma(void) {
+    np_empacotar_quadro();
+    np_disparar_dma();
+}
+
+// Transmite por DMA o último quadro publicado, se houver um novo e o anterior já terminou.
+// Pensada para o núcleo que só transmite enquanto o outro compõe com begin/commit.
+bool np_present_frame(void) {
+    if (!np_quadro_pendente || npQuadroEmAndamento()) return false;
+    np_iniciar_dma();
+    return true;
+}
+
+// Verdadeiro enquanto o DMA estiver ativo ou o PIO ainda não tiver travado o quadro anterior.
+bool npQuadroEmAndamento(void) {
+    if (np_dma_ocupado) return true;
+    return (np_porta_agora_us() - np_fim_envio_us) < NP_TEMPO_LATCH_US;
+}
+
+void npAguardarQuadro(void) {
+    while (npQuadroEmAndamento()) {
+        np_porta_esperar();
+    }
+}
+
+void npSetCallbackQuadro(npCallbackQuadro_t cb) {
+    np_callback = cb;
+}
+
+// Brilho global (0 a 255) aplicado a todos os quadros enviados.
+void npSetBrilho(uint8_t brilho) {
+    np_trava_entrar();
+    np_brilho = brilho;
+    np_atualizar_lut();
+    np_trava_sair();
+}
+
+// Liga/desliga a correção de gama no empacotamento.
+void npSetGamma(bool ativo) {
+    np_trava_entrar();
+    np_gamma_ativo = ativo;
+    np_atualizar_lut();
+    np_trava_sair();
+}
+
+// Publica o buffer e dispara o DMA sem bloquear. Retorna false se ainda há quadro em
+// andamento; o quadro fica publicado e pode ser enviado depois por np_present_frame().
+bool npWriteAsync(void) {
+    np_commit_frame();
+    if (npQuadroEmAndamento()) return false;
+    np_iniciar_dma();
+    return true;
+}
+
+// Envia um gráfico rolante de NUM_COLUNAS colunas de NUM_LINHAS LEDs (y = 0 no topo).
+// O mapeamento para a fita acontece aqui, no empacotamento: quem desenha só escreve a
+// coluna nova. O quadro não passa pelo buffer duplo; espera o anterior e não bloqueia.
+void npWriteGrafico(const grafico_rolante_t *g) {
+    npAguardarQuadro();
+    np_trava_entrar();
+    for (unsigned x = 0; x < NUM_COLUNAS; ++x) {
+        const npLED_t *coluna = (const npLED_t *)grafico_coluna(g, x);
+        for (unsigned y = 0; y < NUM_LINHAS; ++y) {
+            np_quadro[np_mapa[y][x]] = np_empacotar(&coluna[y]);
+        }
+    }
+    np_trava_sair();
+    np_disparar_dma();
+}
+
+void npWrite(void) {
+    np_commit_frame();
+    npAguardarQuadro();
+    np_empacotar_quadro();
+    np_porta_enviar(np_quadro, LED_COUNT);
+    np_fim_envio_us = np_porta_agora_us();
+}
+
+void npWriteComBrilho(float brilho) {
+    // Única conversão em ponto flutuante do quadro: o fator vira Q8 (0 a 256).
+    uint32_t escala = brilho <= 0.f ? 0 : brilho >= 1.f ? 256 : (uint32_t)(brilho * 256.f);
+
+    np_commit_frame();
+    npAguardarQuadro();
+    np_trava_entrar();
+    const npLED_t *front = np_buffers[np_front];
+    for (unsigned i = 0; i < LED_COUNT; ++i) {
+        np_quadro[i] = np_empacotar_escala(&front[i], escala);
+    }
+    np_quadro_pendente = false;
+    np_trava_sair();
+
+    np_porta_enviar(np_quadro, LED_COUNT);
+    np_fim_envio_us = np_porta_agora_us();
+}
+
+void npSetLED(uint16_t index, uint8_t r, uint8_t g, uint8_t b) {
+    if (index < LED_COUNT) {
+        leds[index].R = r;
+        leds[index].G = g;
+        leds[index].B = b;
+    }
+}
+
+void npSetAll(uint8_t r, uint8_t g, uint8_t b) {
+    for (unsigned i = 0; i < LED_COUNT; ++i) {
+        npSetLED(i, r, g, b);
+    }
+}
+
+void npClear(void) {
+    npSetAll(0, 0, 0);
+}
+
+// Cada linha lógica ocupa LEDs consecutivos na fita: preenche sem consultar o mapa.
+void npSetLinha(unsigned y, uint8_t r, uint8_t g, uint8_t b) {
+    if (y >= NUM_LINHAS) return;
+    npLED_t *linha = &leds[NP_LINHA_FISICA(y) * NUM_COLUNAS];
+    for (unsigned x = 0; x < NUM_COLUNAS; ++x) {
+        linha[x] = (npLED_t){ .G = g, .R = r, .B = b };
+    }
+}
+
+void npSetColuna(unsigned x, uint8_t r, uint8_t g, uint8_t b) {
+    if (x >= NUM_COLUNAS) return;
+    for (unsigned y = 0; y < NUM_LINHAS; ++y) {
+        leds[np_mapa[y][x]] = (npLED_t){ .G = g, .R = r, .B = b };
+    }
+}
+
+unsigned getLEDIndex(unsigned x, unsigned y) {
+    if (x >= NUM_COLUNAS || y >= NUM_LINHAS) return 0;
+    return np_mapa[y][x];
+}
@@ -0,0 +1,38 @@
+#include <stdio.h>
+#include "neopixel_vazao.h"
+
+void npMultiDividir(unsigned total_leds, unsigned num_fitas, uint16_t *inicio, uint16_t *quantidade) {
+    unsigned base = total_leds / num_fitas;
+    unsigned sobra = total_leds % num_fitas;
+    unsigned proximo = 0;
+
+    for (unsigned i = 0; i < num_fitas; ++i) {
+        inicio[i] = proximo;
+        quantidade[i] = base + (i < sobra ? 1 : 0);
+        proximo += quantidade[i];
+    }
+}
+
+// A fita mais longa define o quadro: ceil(total / fitas) LEDs de 30 us mais o
+// intervalo que npMultiOcupado exige antes do próximo disparo (NP_TEMPO_LATCH_US).
+uint32_t npMultiQuadroUs(unsigned total_leds, unsigned num_fitas) {
+    if (num_fitas == 0) return 0;
+    unsigned leds_por_fita = (total_leds + num_fitas - 1) / num_fitas;
+    return leds_por_fita * NP_TEMPO_LED_US + NP_TEMPO_LATCH_US;
+}
+
+uint32_t npMultiFpsMaximo(unsigned total_leds, unsigned num_fitas) {
+    if (num_fitas == 0) return 0;
+    return 1000000u / npMultiQuadroUs(total_leds, num_fitas);
+}
+
+// Imprime a tabela de vazão (fps teóricos e tempo de quadro) de 1 a 8 fitas.
+void npMultiImprimirVazao(unsigned total_leds) {
+    printf("LEDs: %u\n", total_leds);
+    for (unsigned n = 1; n <= NP_MULTI_MAX_FITAS; ++n) {
+        unsigned leds_por_fita = (total_leds + n - 1) / n;
+        printf("%u fita(s): %4u LEDs/fita, quadro %6lu us, %4lu fps\n", n, leds_por_fita,
+               (unsigned long)npMultiQuadroUs(total_leds, n),
+               (unsigned long)npMultiFpsMaximo(total_leds, n));
+    }
+}
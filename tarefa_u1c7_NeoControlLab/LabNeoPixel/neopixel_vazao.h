@@ -0,0 +1,27 @@
+#ifndef NEOPIXEL_VAZAO_H
+#define NEOPIXEL_VAZAO_H
+
+// Divisão dos LEDs entre as fitas do modo multi-fitas e a calculadora de vazão.
+// Só aritmética: o mesmo código roda na placa e nos testes de host.
+
+#include <stdint.h>
+#include "neopixel_quadro.h"
+
+// Até 8 fitas: 2 blocos PIO x 4 máquinas de estado, cada uma com seu canal DMA.
+#define NP_MULTI_MAX_FITAS 8
+// Capacidade total do quadro empacotado (soma de todas as fitas).
+#define NP_MULTI_MAX_LEDS 1024
+
+// Tempo de um LED na linha de 800 kHz (24 bits x 1,25 us).
+#define NP_TEMPO_LED_US 30
+
+// Trecho [inicio, inicio + quantidade) de cada fita: LEDs consecutivos, com a sobra
+// da divisão nas primeiras fitas.
+void npMultiDividir(unsigned total_leds, unsigned num_fitas, uint16_t *inicio, uint16_t *quantidade);
+
+// Tempo de quadro e quadros por segundo possíveis para total_leds divididos em num_fitas.
+uint32_t npMultiQuadroUs(unsigned total_leds, unsigned num_fitas);
+uint32_t npMultiFpsMaximo(unsigned total_leds, unsigned num_fitas);
+void npMultiImprimirVazao(unsigned total_leds);
+
+#endif
@@ -5,6 +5,9 @@
 #include "efeitos.h"
 #include "efeito_curva_ar.h"
 #include "numeros_neopixel.h"
+#include "motor_efeitos.h"
+#include "LabNeoPixel/neopixel_multi.h"
+#include "LabNeoPixel/bancada_brilho.h"
 #include <time.h>
 #include <stdlib.h>
 #include "pico/time.h"
@@ -13,6 +16,17 @@
 // Define o pino do microcontrolador conectado ao botão A.
 #define BOTAO_A 5 
 
+// Taxa de quadros do motor de efeitos e intervalo entre números sorteados.
+#define FPS_EFEITOS 60
+#define INTERVALO_SORTEIO_US 10000
+
+// Bancada do modo multi-fitas (botão A pressionado ao ligar). Os pinos são livres na
+// placa: sem fitas ligadas o DMA e o PIO levam o mesmo tempo, então a medida vale.
+#define BANCADA_PINOS { 16, 17, 18, 19 }
+#define BANCADA_LEDS NP_MULTI_MAX_LEDS
+#define BANCADA_QUADROS 100
+#define BANCADA_BRILHO_QUADROS 1000
+
 // Variável global para comunicação entre a ISR e o loop principal.
 // Funciona como uma "bandeira" (flag) que a interrupção levanta.
 // A palavra-chave 'volatile' é ESSENCIAL: ela avisa ao compilador que o valor
@@ -20,6 +34,62 @@
 // faça otimizações que poderiam quebrar a lógica do programa.
 volatile bool botao_foi_pressionado = false;
 
+// Motor de efeitos e animação de abertura, avançados pelo laço principal sem sleep_ms().
+static effect_scheduler_t motor;
+static effect_t efeito_abertura;
+
+// Estado do sorteio em andamento: quantos números faltam e quando mostrar o próximo.
+static int sorteios_restantes = 0;
+static uint64_t proximo_sorteio_us = 0;
+
+// Tabela teórica da calculadora e fps medido com BANCADA_LEDS divididos nas fitas.
+static void bancada_multi_fitas(void) {
+    static npLED_t quadro[BANCADA_LEDS];
+    const uint pinos[] = BANCADA_PINOS;
+
+    sleep_ms(2000);     // Tempo para o terminal USB conectar
+    npMultiImprimirVazao(BANCADA_LEDS);
+    if (!npMultiInit(pinos, sizeof(pinos) / sizeof(pinos[0]), quadro, BANCADA_LEDS)) {
+        printf("Bancada: sem maquinas PIO ou canais DMA livres\n");
+        return;
+    }
+    npMultiBancada(BANCADA_QUADROS);
+}
+
+// Empacotamento com brilho por quadro: float por canal (o npWriteComBrilho antigo)
+// contra a tabela, fixa e recalculada a cada quadro. É a comparação de
+// testes/teste_brilho.c, aqui com o float por software do M0+.
+static void bancada_brilho(void) {
+    static npLED_t quadro[LED_COUNT];
+    static uint32_t palavras[3 * LED_COUNT];
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        quadro[i] = (npLED_t){ .G = rand(), .R = rand(), .B = rand() };
+    }
+
+    uint64_t t0 = time_us_64();
+    for (uint q = 0; q < BANCADA_BRILHO_QUADROS; ++q) {
+        bancada_brilho_float(quadro, palavras, LED_COUNT, (q & 0xff) / 255.f);
+    }
+    uint64_t t1 = time_us_64();
+    npSetBrilho(128);
+    for (uint q = 0; q < BANCADA_BRILHO_QUADROS; ++q) {
+        npEmpacotar(quadro, palavras, LED_COUNT);
+    }
+    uint64_t t2 = time_us_64();
+    for (uint q = 0; q < BANCADA_BRILHO_QUADROS; ++q) {
+        npSetBrilho((uint8_t)q);
+        npEmpacotar(quadro, palavras, LED_COUNT);
+    }
+    uint64_t t3 = time_us_64();
+    npSetBrilho(255);
+
+    printf("Brilho: %u quadros de %u LEDs, ns por quadro\n", BANCADA_BRILHO_QUADROS, LED_COUNT);
+    printf("  float %lu, tabela fixa %lu, tabela recalculada %lu\n",
+           (unsigned long)((t1 - t0) * 1000 / BANCADA_BRILHO_QUADROS),
+           (unsigned long)((t2 - t1) * 1000 / BANCADA_BRILHO_QUADROS),
+           (unsigned long)((t3 - t2) * 1000 / BANCADA_BRILHO_QUADROS));
+}
+
 // Função de inicialização do sistema. Executada uma única vez.
 void setup() {
     // Inicializa a comunicação serial para depuração via printf.
@@ -35,6 +105,13 @@ void setup() {
     gpio_init(BOTAO_A);
     gpio_set_dir(BOTAO_A, GPIO_IN);
     gpio_pull_up(BOTAO_A);
+
+    // Botão A pressionado ao ligar: roda as bancadas antes do programa normal.
+    sleep_ms(1);
+    if (!gpio_get(BOTAO_A)) {
+        bancada_multi_fitas();
+        bancada_brilho();
+    }
 }
 
 // Gera e retorna um número inteiro aleatório dentro do intervalo [min, max].
@@ -77,8 +154,15 @@ int main() {
     // A função 'isr_botao' será chamada sempre que ocorrer uma borda de descida.
     gpio_set_irq_enabled_with_callback(BOTAO_A, GPIO_IRQ_EDGE_FALL, true, &isr_botao);
 
+    // Animação de abertura em espiral, executada pelo motor enquanto o botão é atendido.
+    scheduler_init(&motor, &np_matriz, FPS_EFEITOS, time_us_64());
+    effect_start(&efeito_abertura, &np_matriz, EFEITO_ESPIRAL, COR_APAGA, COR_MIN, COR_MIN, 80, true, time_us_64());
+    scheduler_add(&motor, &efeito_abertura);
+
     // Loop principal do programa. Agora ele é responsável por processar a lógica.
     while (true) {
+        uint64_t agora = time_us_64();
+
         // O loop verifica continuamente se a "bandeira" foi levantada pela ISR.
         if (botao_foi_pressionado) {
             // Passo 1: Imediatamente "abaixa a bandeira" (consome o evento).
@@ -86,22 +170,26 @@ int main() {
             // pressionamento de botão.
             botao_foi_pressionado = false;
 
-            // Passo 2: Executa a lógica longa e pesada aqui, no loop principal,
-            // de forma segura e sem bloquear outras interrupções do sistema.
-            int vezes = sorteia_entre(100, 500);
-            printf("\nMostrando %d números aleatórios...\n", vezes);
+            // Passo 2: Encerra a abertura e agenda o sorteio; cada número é mostrado
+            // no seu instante, sem bloquear o laço.
+            scheduler_remove(&motor, &efeito_abertura);
+            sorteios_restantes = sorteia_entre(100, 500);
+            proximo_sorteio_us = agora;
+            printf("\nMostrando %d números aleatórios...\n", sorteios_restantes);
+        }
 
+        if (sorteios_restantes > 0 && agora >= proximo_sorteio_us) {
             int n = sorteia_entre(1, 6);
+            printf("Número sorteado: %d\n", n);
+            mostrar_numero_sorteado(n);
+            sorteios_restantes--;
+            proximo_sorteio_us = agora + INTERVALO_SORTEIO_US;
+        }
 
-            for (int i = 0; i < vezes; i++) {
-                n = sorteia_entre(1, 6);
-                printf("Número sorteado: %d\n", n);
-                mostrar_numero_sorteado(n);
-                sleep_ms(10);
-            }
+        // Avança os efeitos ativos; o quadro só é enviado quando algo mudou.
+        if (scheduler_tick(&motor, agora, np_begin_frame())) {
+            npWriteAsync();
         }
-        // O processador fica livre para executar outras tarefas aqui, se houvesse.
-        // Em vez de ficar preso em um 'tight_loop_contents()', o loop agora tem um propósito.
     }
     // Este retorno nunca é alcançado em um sistema embarcado com loop infinito.
     return 0;
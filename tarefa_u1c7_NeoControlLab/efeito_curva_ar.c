@@ -1,59 +1,49 @@
-#include <stdlib.h>             // rand() e RAND_MAX
+#include <stdlib.h>             // rand() para a semente
 #include "pico/stdlib.h"
 #include "LabNeoPixel/neopixel_driver.h"
 #include "efeito_curva_ar.h"
+#include "serie_ar.h"
+#include "LabNeoPixel/grafico_rolante.h"
 
 #define TAM 5
-static float coef[TAM] = {0.4, -0.2, 0.15, 0.1, 0.05};
-static float estados[TAM] = {0.0};
-static int coluna_atual = 0;
-
-extern npLED_t leds[LED_COUNT];  
-
-
-// Gera ruído aleatório entre -amp e +amp
-static float ruido_aleatorio(float amp) {
-    return ((float)rand() / RAND_MAX) * 2 * amp - amp;
-}
-
-// Gera próximo valor da série AR(5)
-static float proximo_valor_ar() {
-    float valor = 0.0;
-    for (int i = 0; i < TAM; i++) {
-        valor += coef[i] * estados[i];
+static const int16_t coef[TAM] = {
+    AR_Q15(0.4), AR_Q15(-0.2), AR_Q15(0.15), AR_Q15(0.1), AR_Q15(0.05)
+};
+static serie_ar_t serie;
+static bool serie_iniciada = false;
+
+// Gera próximo valor da série AR(5), em Q11
+static int16_t proximo_valor_ar() {
+    if (!serie_iniciada) {
+        serie_ar_init(&serie, coef, TAM, AR_Q11(1.0), (uint32_t)rand());
+        serie_iniciada = true;
     }
-    valor += ruido_aleatorio(1.0f);
-
-    for (int i = TAM - 1; i > 0; i--) {
-        estados[i] = estados[i - 1];
-    }
-    estados[0] = valor;
-
-    return valor;
+    return serie_ar_proximo(&serie);
 }
 
+// Histórico das barras: uma coluna de NUM_LINHAS LEDs por passo, em buffer circular.
+static uint8_t historico[NUM_COLUNAS * NUM_LINHAS * sizeof(npLED_t)];
+static grafico_rolante_t grafico;
+
 // Efeito gráfico com barras verticais, partindo da linha central (2)
 void efeitoCurvaNeoPixel(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    float valor = proximo_valor_ar();
+    int32_t valor = proximo_valor_ar();
 
     int linha_ref = 2;
-    int deslocamento = (int)(valor * 1.5f);
+    int deslocamento = (valor * 3) / (2 << AR_FRAC_BITS);   // valor * 1,5, truncado como antes
     int linha_destino = linha_ref - deslocamento;
 
     if (linha_destino < 0) linha_destino = 0;
     if (linha_destino > NUM_LINHAS - 1) linha_destino = NUM_LINHAS - 1;
 
-    // --- Etapa 1: desloca toda a matriz uma coluna à esquerda
-    for (int linha = 0; linha < NUM_LINHAS; linha++) {
-        for (int coluna = 0; coluna < NUM_COLUNAS - 1; coluna++) {
-            int idx_atual = linha * NUM_COLUNAS + coluna;
-            int idx_prox  = linha * NUM_COLUNAS + coluna + 1;
-            leds[idx_atual] = leds[idx_prox];  // desloca o conteúdo da direita para a esquerda
-        }
+    if (grafico.dados == NULL) {
+        grafico_init(&grafico, historico, NUM_COLUNAS, NUM_LINHAS * sizeof(npLED_t));
     }
 
-    // --- Etapa 2: escreve nova barra na coluna final (coluna 4)
-    int nova_coluna = NUM_COLUNAS - 1;
+    // --- Etapa 1: rola o gráfico; só a nova coluna (já apagada) é escrita
+    npLED_t *nova = (npLED_t *)grafico_nova_coluna(&grafico);
+
+    // --- Etapa 2: escreve a nova barra entre a linha de referência e a de destino
     int inicio = linha_ref;
     int fim = linha_destino;
     if (inicio > fim) {
@@ -62,16 +52,11 @@ void efeitoCurvaNeoPixel(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
         fim = temp;
     }
 
-    for (int linha = 0; linha < NUM_LINHAS; linha++) {
-        int index = linha * NUM_COLUNAS + nova_coluna;
-        if (linha >= inicio && linha <= fim) {
-            npSetLED(index, r, g, b);
-        } else {
-            npSetLED(index, 0, 0, 0); // apaga o restante da coluna
-        }
+    for (int linha = inicio; linha <= fim; linha++) {
+        nova[linha] = (npLED_t){ .G = g, .R = r, .B = b };
     }
 
-    // Atualiza os LEDs
-    npWrite();
+    // --- Etapa 3: o driver mapeia as colunas para a matriz física ao empacotar
+    npWriteGrafico(&grafico);
     sleep_ms(delay_ms);
 }
@@ -0,0 +1,49 @@
+#include <string.h>
+#include "serie_ar.h"
+
+// xorshift32: três deslocamentos e XORs por número, sem divisão como em rand() / RAND_MAX.
+static inline uint32_t xorshift32(uint32_t *estado) {
+    uint32_t x = *estado;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *estado = x;
+    return x;
+}
+
+void serie_ar_init(serie_ar_t *s, const int16_t *coef, uint8_t ordem, int16_t amp_ruido, uint32_t semente) {
+    if (ordem > AR_ORDEM_MAX) ordem = AR_ORDEM_MAX;
+    memset(s, 0, sizeof(*s));
+    memcpy(s->coef, coef, ordem * sizeof(coef[0]));
+    s->ordem = ordem;
+    s->amp_ruido = amp_ruido;
+    s->semente = semente ? semente : 0x9E3779B9u;
+}
+
+// Próxima amostra (Q11): soma dos coeficientes pelo histórico, percorrido a partir da
+// cabeça sem deslocar elementos, mais ruído uniforme em [-amp, +amp).
+int16_t serie_ar_proximo(serie_ar_t *s) {
+    int32_t acc = 0;
+    uint8_t idx = s->cabeca;
+    for (uint8_t i = 0; i < s->ordem; i++) {
+        acc += (int32_t)s->coef[i] * s->estados[idx];
+        idx = idx ? idx - 1 : s->ordem - 1;
+    }
+
+    int32_t ruido = (int32_t)(xorshift32(&s->semente) >> 16) - 32768;   // [-1, 1) em Q15
+    int32_t valor = (acc >> 15) + ((ruido * s->amp_ruido) >> 15);
+
+    if (valor > INT16_MAX) valor = INT16_MAX;
+    if (valor < INT16_MIN) valor = INT16_MIN;
+
+    s->cabeca = (s->cabeca + 1 == s->ordem) ? 0 : s->cabeca + 1;   // Sobrescreve a mais antiga
+    s->estados[s->cabeca] = (int16_t)valor;
+    return (int16_t)valor;
+}
+
+// Gera n amostras de uma vez (para gráficos ou testes).
+void serie_ar_gerar(serie_ar_t *s, int16_t *saida, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) {
+        saida[i] = serie_ar_proximo(s);
+    }
+}
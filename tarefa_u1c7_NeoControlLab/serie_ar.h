@@ -0,0 +1,28 @@
+#ifndef SERIE_AR_H
+#define SERIE_AR_H
+
+#include <stdint.h>
+
+// Gerador AR(p) em ponto fixo: coeficientes em Q15 e amostras em Q11 (faixa de ±16),
+// de modo que cada produto coeficiente x amostra cabe em 32 bits sem FPU.
+#define AR_ORDEM_MAX 8
+#define AR_FRAC_BITS 11
+
+// Conversões em tempo de compilação a partir de constantes em ponto flutuante.
+#define AR_Q15(x) ((int16_t)((x) * 32768.0 + ((x) >= 0 ? 0.5 : -0.5)))
+#define AR_Q11(x) ((int16_t)((x) * 2048.0 + ((x) >= 0 ? 0.5 : -0.5)))
+
+typedef struct {
+    int16_t coef[AR_ORDEM_MAX];     // coef[i] multiplica a amostra de i+1 passos atrás
+    int16_t estados[AR_ORDEM_MAX];  // Histórico circular; estados[cabeca] é a mais recente
+    uint8_t ordem;
+    uint8_t cabeca;
+    int16_t amp_ruido;              // Amplitude do ruído uniforme, em Q11
+    uint32_t semente;               // Estado do xorshift32 (nunca zero)
+} serie_ar_t;
+
+void serie_ar_init(serie_ar_t *s, const int16_t *coef, uint8_t ordem, int16_t amp_ruido, uint32_t semente);
+int16_t serie_ar_proximo(serie_ar_t *s);
+void serie_ar_gerar(serie_ar_t *s, int16_t *saida, uint32_t n);
+
+#endif
@@ -0,0 +1,86 @@
+#include <string.h>
+#include <pthread.h>
+#include "neopixel_porta.h"
+#include "neopixel_falso.h"
+
+uint64_t falso_agora_us = 0;
+uint32_t falso_linha[LED_COUNT];
+unsigned falso_quadros = 0;
+uint64_t falso_inicio_us = 0;
+int falso_trava_profundidade = 0;
+
+// A trava do Pico (critical_section) vira um mutex: o teste de concorrência usa duas threads.
+static pthread_mutex_t trava = PTHREAD_MUTEX_INITIALIZER;
+
+static const uint32_t *dma_origem = NULL;
+static unsigned dma_n = 0;
+static uint64_t dma_inicio_us = 0;
+static uint64_t dma_fim_us = 0;
+
+static void entregar(const uint32_t *palavras, unsigned n, uint64_t inicio) {
+    memcpy(falso_linha, palavras, n * sizeof(uint32_t));
+    falso_inicio_us = inicio;
+    falso_quadros++;
+}
+
+void np_trava_iniciar(void) {
+    falso_trava_profundidade = 0;
+}
+
+void np_trava_entrar(void) {
+    pthread_mutex_lock(&trava);
+    falso_trava_profundidade++;
+}
+
+void np_trava_sair(void) {
+    falso_trava_profundidade--;
+    pthread_mutex_unlock(&trava);
+}
+
+uint64_t np_porta_agora_us(void) {
+    return falso_agora_us;
+}
+
+void np_porta_esperar(void) {
+    falso_avancar_us(1);
+}
+
+void np_porta_disparar(const uint32_t *palavras, unsigned n) {
+    dma_origem = palavras;
+    dma_n = n;
+    dma_inicio_us = falso_agora_us;
+    dma_fim_us = falso_agora_us + (uint64_t)n * FALSO_US_POR_LED;
+}
+
+// Só as palavras que não cabem no FIFO seguram a CPU.
+void np_porta_enviar(const uint32_t *palavras, unsigned n) {
+    entregar(palavras, n, falso_agora_us);
+    if (n > FALSO_FIFO_PALAVRAS) falso_agora_us += (uint64_t)(n - FALSO_FIFO_PALAVRAS) * FALSO_US_POR_LED;
+}
+
+void falso_avancar_us(uint64_t us) {
+    uint64_t destino = falso_agora_us + us;
+    if (dma_origem && dma_fim_us <= destino) {
+        falso_agora_us = dma_fim_us;
+        entregar(dma_origem, dma_n, dma_inicio_us);
+        dma_origem = NULL;
+        np_quadro_enviado();
+    }
+    falso_agora_us = destino;
+}
+
+bool falso_dma_ativo(void) {
+    return dma_origem != NULL;
+}
+
+unsigned falso_pio_bits(const uint32_t *palavras, unsigned n, unsigned limiar, uint8_t *bits) {
+    unsigned total = 0;
+    for (unsigned i = 0; i < n; ++i) {
+        uint32_t osr = palavras[i];
+        for (unsigned b = 0; b < limiar; ++b) {
+            bits[total++] = osr & 1;
+            osr >>= 1;
+        }
+    }
+    return total;
+}
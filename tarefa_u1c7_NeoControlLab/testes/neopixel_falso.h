@@ -0,0 +1,31 @@
+#ifndef NEOPIXEL_FALSO_H
+#define NEOPIXEL_FALSO_H
+
+// Porta falsa do driver NeoPixel (neopixel_porta.h) para os testes de host: relógio
+// virtual, DMA que termina depois do tempo de linha das palavras e um PIO que
+// registra o quadro que de fato saiu e os bits na ordem em que vão para o fio.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "neopixel_quadro.h"
+
+#define FALSO_US_POR_LED 30     // 24 bits a 800 kHz
+#define FALSO_FIFO_PALAVRAS 8   // FIFO TX unido: put_blocking retorna antes do fim da linha
+
+extern uint64_t falso_agora_us;
+
+// Último quadro entregue ao PIO (lido no fim do DMA, como o hardware faria) e quando começou.
+extern uint32_t falso_linha[LED_COUNT];
+extern unsigned falso_quadros;
+extern uint64_t falso_inicio_us;
+extern int falso_trava_profundidade;
+
+// Avança o relógio; se o DMA em curso termina nesse intervalo, conclui no instante exato.
+void falso_avancar_us(uint64_t us);
+bool falso_dma_ativo(void);
+
+// Emula o ws2818b: autopull a cada 'limiar' bits, deslocando à direita (bit 0 sai primeiro).
+// Devolve a quantidade de bits escritos em 'bits'.
+unsigned falso_pio_bits(const uint32_t *palavras, unsigned n, unsigned limiar, uint8_t *bits);
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * teste_brilho.c
+ *
+ * Brilho global por tabela (npSetBrilho + npEmpacotar) contra o caminho antigo
+ * em float (bancada_brilho_float, o npWriteComBrilho original):
+ *  - para todo valor de canal e todo brilho, a tabela difere do float em no
+ *    máximo 1 nível, e com brilho 255 os valores passam intactos;
+ *  - tempo por quadro dos dois caminhos, com a tabela fixa (brilho constante)
+ *    e recalculada a cada quadro (brilho animado).
+ *
+ * No host o float é por hardware; no Cortex-M0+ é por software, e a mesma
+ * comparação roda na placa (bancada_brilho em NeoControlLab.c).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "neopixel_quadro.h"
+#include "bancada_brilho.h"
+#include "neopixel_falso.h"
+
+#define QUADROS 200000
+#define DIFERENCA_MAXIMA 1
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static volatile uint32_t sumidouro;     // Impede que o compilador descarte os laços medidos
+
+static uint64_t agora_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + t.tv_nsec;
+}
+
+static void teste_precisao(void) {
+    int pior = 0, pior_v = 0, pior_b = 0, alterados = 0;
+
+    for (int b = 0; b < 256; ++b) {
+        npSetBrilho((uint8_t)b);
+        for (int v = 0; v < 256; ++v) {
+            npLED_t led = { .G = (uint8_t)v, .R = (uint8_t)v, .B = (uint8_t)v };
+            uint32_t lut, antigo[3];
+            npEmpacotar(&led, &lut, 1);
+            bancada_brilho_float(&led, antigo, 1, b / 255.f);
+
+            int d = abs((int)(lut & 0xff) - (int)antigo[0]);
+            if (d > pior) { pior = d; pior_v = v; pior_b = b; }
+            if (b == 255 && (lut & 0xff) != (uint32_t)v) alterados++;
+        }
+    }
+    npSetBrilho(255);
+    VERIFICAR(pior <= DIFERENCA_MAXIMA, "tabela difere do float em %d níveis (valor %d, brilho %d)",
+              pior, pior_v, pior_b);
+    VERIFICAR(alterados == 0, "brilho 255 altera %d valores", alterados);
+    printf("diferenca maxima tabela x float: %d nivel(is)\n", pior);
+}
+
+static void teste_tempo(void) {
+    static npLED_t quadro[LED_COUNT];
+    static uint32_t palavras[3 * LED_COUNT];
+    for (unsigned i = 0; i < LED_COUNT; ++i) {
+        quadro[i] = (npLED_t){ .G = rand(), .R = rand(), .B = rand() };
+    }
+
+    uint64_t t0 = agora_ns();
+    for (unsigned q = 0; q < QUADROS; ++q) {
+        bancada_brilho_float(quadro, palavras, LED_COUNT, (q & 0xff) / 255.f);
+        sumidouro += palavras[q % (3 * LED_COUNT)];
+    }
+    uint64_t t1 = agora_ns();
+    npSetBrilho(128);
+    for (unsigned q = 0; q < QUADROS; ++q) {
+        npEmpacotar(quadro, palavras, LED_COUNT);
+        sumidouro += palavras[q % LED_COUNT];
+    }
+    uint64_t t2 = agora_ns();
+    for (unsigned q = 0; q < QUADROS; ++q) {
+        npSetBrilho((uint8_t)q);
+        npEmpacotar(quadro, palavras, LED_COUNT);
+        sumidouro += palavras[q % LED_COUNT];
+    }
+    uint64_t t3 = agora_ns();
+    npSetBrilho(255);
+
+    printf("%d LEDs por quadro, %d quadros:\n", LED_COUNT, QUADROS);
+    printf("  float por canal      %6.1f ns/quadro\n", (double)(t1 - t0) / QUADROS);
+    printf("  tabela fixa          %6.1f ns/quadro\n", (double)(t2 - t1) / QUADROS);
+    printf("  tabela recalculada   %6.1f ns/quadro\n", (double)(t3 - t2) / QUADROS);
+}
+
+int main(void) {
+    npPrepararDriver();
+    teste_precisao();
+    teste_tempo();
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
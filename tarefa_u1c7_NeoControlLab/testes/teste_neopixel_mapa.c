@@ -0,0 +1,77 @@
+/**
+ * teste_neopixel_mapa.c
+ *
+ * Geometria da matriz na ligação padrão da BitDogLab:
+ *  - NP_XY, np_mapa e getLEDIndex dão, nas 25 posições, o mesmo índice que a
+ *    fórmula antiga de getLEDIndex;
+ *  - np_espiral passa uma vez por cada LED, começa no canto superior esquerdo,
+ *    anda sempre para uma posição vizinha e termina no centro.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "neopixel_quadro.h"
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+// getLEDIndex antes do mapa gerado: LED 0 embaixo à direita, serpentina.
+static unsigned indice_antigo(unsigned x, unsigned y) {
+    unsigned linha_fisica = NUM_LINHAS - 1 - y;
+    unsigned base = linha_fisica * NUM_COLUNAS;
+    return (linha_fisica % 2 == 0) ? base + (NUM_COLUNAS - 1 - x) : base + x;
+}
+
+static void teste_indices(void) {
+    for (unsigned y = 0; y < NUM_LINHAS; ++y) {
+        for (unsigned x = 0; x < NUM_COLUNAS; ++x) {
+            unsigned esperado = indice_antigo(x, y);
+            VERIFICAR(NP_XY(x, y) == esperado, "NP_XY(%u, %u) = %u, esperado %u", x, y, (unsigned)NP_XY(x, y), esperado);
+            VERIFICAR(np_mapa[y][x] == esperado, "np_mapa[%u][%u] = %u, esperado %u", y, x, np_mapa[y][x], esperado);
+            VERIFICAR(getLEDIndex(x, y) == esperado, "getLEDIndex(%u, %u) = %u, esperado %u", x, y, getLEDIndex(x, y), esperado);
+        }
+    }
+    VERIFICAR(getLEDIndex(NUM_COLUNAS, 0) == 0 && getLEDIndex(0, NUM_LINHAS) == 0, "fora da matriz não devolve 0");
+}
+
+static void teste_espiral(void) {
+    // Posição (x, y) de cada índice da fita, pelo mapa.
+    int px[LED_COUNT], py[LED_COUNT], visto[LED_COUNT] = { 0 };
+    for (unsigned y = 0; y < NUM_LINHAS; ++y) {
+        for (unsigned x = 0; x < NUM_COLUNAS; ++x) {
+            px[np_mapa[y][x]] = x;
+            py[np_mapa[y][x]] = y;
+        }
+    }
+
+    for (unsigned i = 0; i < LED_COUNT; ++i) {
+        unsigned led = np_espiral[i];
+        VERIFICAR(led < LED_COUNT && !visto[led], "espiral[%u] = %u repetido ou fora da fita", i, led);
+        if (led >= LED_COUNT) return;
+        visto[led] = 1;
+        if (i > 0) {
+            unsigned ant = np_espiral[i - 1];
+            int passo = abs(px[led] - px[ant]) + abs(py[led] - py[ant]);
+            VERIFICAR(passo == 1, "espiral[%u]: (%d, %d) não é vizinho de (%d, %d)",
+                      i, px[led], py[led], px[ant], py[ant]);
+        }
+    }
+    VERIFICAR(np_espiral[0] == np_mapa[0][0], "espiral não começa no canto superior esquerdo");
+    VERIFICAR(np_espiral[LED_COUNT - 1] == np_mapa[NUM_LINHAS / 2][NUM_COLUNAS / 2], "espiral não termina no centro");
+}
+
+int main(void) {
+    npPrepararDriver();
+    teste_indices();
+    teste_espiral();
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
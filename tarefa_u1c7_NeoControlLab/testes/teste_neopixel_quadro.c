@@ -0,0 +1,155 @@
+/**
+ * teste_neopixel_quadro.c
+ *
+ * Núcleo do driver NeoPixel sobre a porta falsa (neopixel_falso.c):
+ *  - cada LED vira uma palavra de 24 bits G | R << 8 | B << 16, e o PIO com
+ *    autopull de 24 bits põe no fio os mesmos bits que o driver antigo, que
+ *    enviava G, R e B em três palavras de 8 bits;
+ *  - brilho e gama entram pela tabela;
+ *  - sequência de quadros: np_present_frame recusa enquanto o DMA corre e
+ *    durante os NP_TEMPO_LATCH_US seguintes, e o quadro que sai é o publicado.
+ */
+
+#include <stdio.h>
+#include "neopixel_quadro.h"
+#include "neopixel_falso.h"
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+#define TEMPO_QUADRO_US ((uint64_t)LED_COUNT * FALSO_US_POR_LED)
+
+static unsigned callbacks = 0;
+static void contar_callback(void) { callbacks++; }
+
+// Cor distinta por LED e por canal, para que qualquer troca de byte ou de posição apareça.
+static void pintar(npLED_t *quadro, uint8_t semente) {
+    for (unsigned i = 0; i < LED_COUNT; ++i) {
+        quadro[i] = (npLED_t){ .G = (uint8_t)(semente + 3 * i),
+                               .R = (uint8_t)(semente + 3 * i + 1),
+                               .B = (uint8_t)(semente + 3 * i + 2) };
+    }
+}
+
+static void teste_palavra(void) {
+    npLED_t led = { .G = 0x12, .R = 0x34, .B = 0x56 };
+    uint32_t palavra;
+
+    npEmpacotar(&led, &palavra, 1);
+    VERIFICAR(palavra == 0x563412, "palavra GRB 0x%06x, esperado 0x563412", (unsigned)palavra);
+
+    // No fio: os bits do driver antigo (G, R, B, cada um numa palavra de 8 bits).
+    npLED_t quadro[LED_COUNT];
+    uint32_t novo[LED_COUNT], antigo[3 * LED_COUNT];
+    pintar(quadro, 7);
+    npEmpacotar(quadro, novo, LED_COUNT);
+    for (unsigned i = 0; i < LED_COUNT; ++i) {
+        antigo[3 * i] = quadro[i].G;
+        antigo[3 * i + 1] = quadro[i].R;
+        antigo[3 * i + 2] = quadro[i].B;
+    }
+    static uint8_t bits_novo[24 * LED_COUNT], bits_antigo[24 * LED_COUNT];
+    unsigned n_novo = falso_pio_bits(novo, LED_COUNT, 24, bits_novo);
+    unsigned n_antigo = falso_pio_bits(antigo, 3 * LED_COUNT, 8, bits_antigo);
+    VERIFICAR(n_novo == n_antigo, "%u bits no fio, esperado %u", n_novo, n_antigo);
+    for (unsigned b = 0; b < n_novo && b < n_antigo; ++b) {
+        if (bits_novo[b] != bits_antigo[b]) {
+            VERIFICAR(0, "bit %u (LED %u) difere do envio em 3 x 8 bits", b, b / 24);
+            break;
+        }
+    }
+
+    // Brilho 128: (v * 129) >> 8 por canal; a gama 2,8 leva 128 a 37.
+    npSetBrilho(128);
+    npEmpacotar(&led, &palavra, 1);
+    uint32_t esperado = ((0x12 * 129) >> 8) | (((0x34 * 129) >> 8) << 8) | (((0x56 * 129) >> 8) << 16);
+    VERIFICAR(palavra == esperado, "brilho 128: 0x%06x, esperado 0x%06x", (unsigned)palavra, (unsigned)esperado);
+    npSetBrilho(255);
+    npSetGamma(true);
+    led = (npLED_t){ .G = 128, .R = 255, .B = 0 };
+    npEmpacotar(&led, &palavra, 1);
+    VERIFICAR(palavra == (37u | 255u << 8), "gama: 0x%06x, esperado 0x00ff25", (unsigned)palavra);
+    npSetGamma(false);
+    VERIFICAR(falso_trava_profundidade == 0, "trava não liberada (%d)", falso_trava_profundidade);
+}
+
+static void teste_sequencia(void) {
+    npSetCallbackQuadro(contar_callback);
+    falso_avancar_us(NP_TEMPO_LATCH_US);
+    uint32_t esperado[LED_COUNT];
+
+    // Quadro 1 sai por DMA assim que publicado.
+    pintar(np_begin_frame(), 1);
+    npEmpacotar(np_begin_frame(), esperado, LED_COUNT);
+    uint64_t t0 = falso_agora_us;
+    VERIFICAR(npWriteAsync(), "primeiro quadro recusado com a linha livre");
+    VERIFICAR(falso_dma_ativo() && !np_quadro_concluido, "DMA não disparado");
+
+    // Quadro 2 publicado com o DMA ativo: fica pendente.
+    pintar(np_begin_frame(), 100);
+    np_commit_frame();
+    VERIFICAR(!np_present_frame(), "present aceito com o DMA ativo");
+    falso_avancar_us(TEMPO_QUADRO_US - 1);
+    VERIFICAR(!np_present_frame() && falso_quadros == 0, "quadro terminou antes do tempo de linha");
+
+    falso_avancar_us(1);
+    VERIFICAR(falso_quadros == 1 && np_quadro_concluido && callbacks == 1,
+              "fim do DMA: quadros %u, concluido %d, callbacks %u", falso_quadros, np_quadro_concluido, callbacks);
+    VERIFICAR(falso_inicio_us == t0, "quadro 1 começou em %llu, esperado %llu",
+              (unsigned long long)falso_inicio_us, (unsigned long long)t0);
+    for (unsigned i = 0; i < LED_COUNT; ++i) {
+        VERIFICAR(falso_linha[i] == esperado[i], "quadro 1, LED %u: 0x%06x, esperado 0x%06x",
+                  i, (unsigned)falso_linha[i], (unsigned)esperado[i]);
+    }
+
+    // Latch: o PIO ainda esvazia o FIFO e a linha precisa ficar em RESET.
+    uint64_t fim = falso_agora_us;
+    falso_avancar_us(NP_TEMPO_LATCH_US - 1);
+    VERIFICAR(npQuadroEmAndamento() && !np_present_frame(), "present aceito dentro do latch");
+    falso_avancar_us(1);
+    npLED_t quadro2[LED_COUNT];
+    pintar(quadro2, 100);
+    npEmpacotar(quadro2, esperado, LED_COUNT);
+    VERIFICAR(np_present_frame(), "present recusado %llu us depois do fim do DMA",
+              (unsigned long long)(falso_agora_us - fim));
+    VERIFICAR(!np_present_frame(), "present aceito sem quadro novo e com o DMA ativo");
+    falso_avancar_us(TEMPO_QUADRO_US);
+    VERIFICAR(falso_quadros == 2 && callbacks == 2, "quadro 2 não enviado (%u)", falso_quadros);
+    for (unsigned i = 0; i < LED_COUNT; ++i) {
+        VERIFICAR(falso_linha[i] == esperado[i], "quadro 2, LED %u: 0x%06x, esperado 0x%06x",
+                  i, (unsigned)falso_linha[i], (unsigned)esperado[i]);
+    }
+
+    // Sem quadro novo, nada sai mesmo com a linha livre.
+    falso_avancar_us(NP_TEMPO_LATCH_US);
+    VERIFICAR(!np_present_frame(), "present reenviou um quadro já enviado");
+
+    // npWrite bloqueante respeita o DMA e o latch do quadro anterior.
+    pintar(np_begin_frame(), 200);
+    VERIFICAR(npWriteAsync(), "quadro 3 recusado com a linha livre");
+    fim = falso_agora_us + TEMPO_QUADRO_US;
+    pintar(np_begin_frame(), 50);
+    npWrite();
+    VERIFICAR(falso_quadros == 4, "npWrite: %u quadros, esperado 4", falso_quadros);
+    VERIFICAR(falso_inicio_us >= fim + NP_TEMPO_LATCH_US,
+              "npWrite começou %lld us depois do fim do DMA, antes do latch",
+              (long long)(falso_inicio_us - fim));
+    VERIFICAR(npQuadroEmAndamento(), "sem latch depois de npWrite");
+    VERIFICAR(falso_trava_profundidade == 0, "trava não liberada (%d)", falso_trava_profundidade);
+}
+
+int main(void) {
+    npPrepararDriver();
+    teste_palavra();
+    teste_sequencia();
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
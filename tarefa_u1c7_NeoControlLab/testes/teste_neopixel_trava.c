@@ -0,0 +1,97 @@
+/**
+ * teste_neopixel_trava.c
+ *
+ * Buffer duplo sob concorrência: uma thread compõe e publica quadros com
+ * np_begin_frame/np_commit_frame enquanto outra, no papel do núcleo que
+ * transmite, empacota e envia com np_present_frame. Cada quadro tem todos os
+ * LEDs iguais e os três canais derivados do mesmo número, então um quadro que
+ * mistura dois publicados aparece como LEDs ou canais diferentes. Com mais
+ * de um núcleo no host as threads correm de fato em paralelo, como no RP2040.
+ */
+
+#include <stdio.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <sched.h>
+#include "neopixel_quadro.h"
+#include "neopixel_falso.h"
+
+#define DURACAO_NS 300000000ull
+#define MINIMO_ENVIADOS 1000
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static atomic_bool fim_envio = false;
+static uint32_t compostos = 0;
+
+static uint64_t agora_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + t.tv_nsec;
+}
+
+static uint32_t palavra_do_quadro(uint32_t k) {
+    return (k & 0xff) | (((k + 1) & 0xff) << 8) | (((k + 2) & 0xff) << 16);
+}
+
+static void *compor(void *arg) {
+    (void)arg;
+    for (uint32_t k = 1; !atomic_load(&fim_envio); ++k) {
+        npLED_t *quadro = np_begin_frame();
+        for (unsigned i = 0; i < LED_COUNT; ++i) {
+            quadro[i] = (npLED_t){ .G = (uint8_t)k, .R = (uint8_t)(k + 1), .B = (uint8_t)(k + 2) };
+        }
+        np_commit_frame();
+        compostos = k;
+        sched_yield();      // Nem o mutex nem o escalonador são justos: alterna as threads
+    }
+    return NULL;
+}
+
+int main(void) {
+    npPrepararDriver();
+    falso_avancar_us(NP_TEMPO_LATCH_US);
+
+    pthread_t compositor;
+    pthread_create(&compositor, NULL, compor, NULL);
+
+    unsigned enviados = 0, misturados = 0;
+    uint64_t inicio = agora_ns();
+    while (agora_ns() - inicio < DURACAO_NS) {
+        if (!np_present_frame()) {
+            sched_yield();
+            continue;
+        }
+        falso_avancar_us((uint64_t)LED_COUNT * FALSO_US_POR_LED + NP_TEMPO_LATCH_US);
+        enviados++;
+
+        // O primeiro LED define o quadro; os demais e os três canais têm de bater com ele.
+        uint32_t k = falso_linha[0] & 0xff;
+        bool misturado = falso_linha[0] != palavra_do_quadro(k);
+        for (unsigned i = 1; i < LED_COUNT; ++i) {
+            if (falso_linha[i] != falso_linha[0]) misturado = true;
+        }
+        if (misturado && misturados++ == 0) {
+            printf("quadro %u misturado: LED 0 = 0x%06x, LED %u = 0x%06x\n", enviados,
+                   (unsigned)falso_linha[0], LED_COUNT - 1, (unsigned)falso_linha[LED_COUNT - 1]);
+        }
+    }
+    atomic_store(&fim_envio, true);
+    pthread_join(compositor, NULL);
+
+    VERIFICAR(misturados == 0, "%u de %u quadros enviados misturam dois publicados", misturados, enviados);
+    VERIFICAR(enviados >= MINIMO_ENVIADOS, "só %u quadros enviados durante a composição", enviados);
+    printf("%u quadros compostos, %u enviados\n", (unsigned)compostos, enviados);
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * teste_neopixel_vazao.c
+ *
+ * Aritmética do modo multi-fitas (neopixel_vazao.c):
+ *  - npMultiDividir cobre os LEDs em trechos consecutivos, sem buracos nem
+ *    sobreposição, com tamanhos que diferem de no máximo 1 e a sobra nas
+ *    primeiras fitas, para todo total até NP_MULTI_MAX_LEDS e 1 a 8 fitas;
+ *  - o tempo de quadro é o da fita mais longa mais NP_TEMPO_LATCH_US, o mesmo
+ *    intervalo que npMultiOcupado impõe, e o fps não promete mais que isso.
+ */
+
+#include <stdio.h>
+#include "neopixel_vazao.h"
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static void teste_divisao(void) {
+    for (unsigned n = 1; n <= NP_MULTI_MAX_FITAS; ++n) {
+        for (unsigned total = 0; total <= NP_MULTI_MAX_LEDS; ++total) {
+            uint16_t inicio[NP_MULTI_MAX_FITAS], quantidade[NP_MULTI_MAX_FITAS];
+            npMultiDividir(total, n, inicio, quantidade);
+
+            unsigned proximo = 0, maior = 0;
+            bool ok = true;
+            for (unsigned i = 0; i < n; ++i) {
+                ok &= inicio[i] == proximo;
+                ok &= i == 0 || quantidade[i] <= quantidade[i - 1];
+                ok &= quantidade[i] + 1 >= quantidade[0];
+                proximo += quantidade[i];
+                if (quantidade[i] > maior) maior = quantidade[i];
+            }
+            ok &= proximo == total;
+            ok &= maior == (total + n - 1) / n;
+            VERIFICAR(ok, "%u LEDs em %u fitas: divisão inválida", total, n);
+            if (!ok) return;
+        }
+    }
+}
+
+static void teste_vazao(void) {
+    // Casos conhecidos: a matriz 5x5 numa fita e o quadro cheio em 1, 3 e 8 fitas.
+    static const struct { unsigned total, fitas; uint32_t quadro_us, fps; } casos[] = {
+        {   25, 1,   750 + NP_TEMPO_LATCH_US, 1000000u / (750 + NP_TEMPO_LATCH_US) },
+        { 1024, 1, 30720 + NP_TEMPO_LATCH_US, 1000000u / (30720 + NP_TEMPO_LATCH_US) },
+        { 1024, 3, 10260 + NP_TEMPO_LATCH_US, 1000000u / (10260 + NP_TEMPO_LATCH_US) },
+        { 1024, 8,  3840 + NP_TEMPO_LATCH_US, 1000000u / (3840 + NP_TEMPO_LATCH_US) },
+    };
+    for (unsigned c = 0; c < sizeof(casos) / sizeof(casos[0]); ++c) {
+        uint32_t q = npMultiQuadroUs(casos[c].total, casos[c].fitas);
+        uint32_t f = npMultiFpsMaximo(casos[c].total, casos[c].fitas);
+        VERIFICAR(q == casos[c].quadro_us && f == casos[c].fps, "%u LEDs em %u fitas: %lu us e %lu fps, esperado %lu us e %lu fps",
+                  casos[c].total, casos[c].fitas, (unsigned long)q, (unsigned long)f,
+                  (unsigned long)casos[c].quadro_us, (unsigned long)casos[c].fps);
+    }
+
+    // Nenhuma combinação promete quadros mais curtos que a linha da fita mais longa
+    // mais o latch que npMultiOcupado exige; mais fitas nunca dão menos fps.
+    for (unsigned total = 1; total <= NP_MULTI_MAX_LEDS; ++total) {
+        uint32_t anterior = 0;
+        for (unsigned n = 1; n <= NP_MULTI_MAX_FITAS; ++n) {
+            uint16_t inicio[NP_MULTI_MAX_FITAS], quantidade[NP_MULTI_MAX_FITAS];
+            npMultiDividir(total, n, inicio, quantidade);
+            uint32_t minimo_us = quantidade[0] * NP_TEMPO_LED_US + NP_TEMPO_LATCH_US;
+            uint32_t fps = npMultiFpsMaximo(total, n);
+            bool ok = (uint64_t)fps * minimo_us <= 1000000u && fps >= anterior;
+            VERIFICAR(ok, "%u LEDs em %u fitas: %lu fps não cabem em quadros de %lu us",
+                      total, n, (unsigned long)fps, (unsigned long)minimo_us);
+            if (!ok) return;
+            anterior = fps;
+        }
+    }
+    VERIFICAR(npMultiFpsMaximo(100, 0) == 0 && npMultiQuadroUs(100, 0) == 0, "0 fitas deveria dar 0");
+}
+
+int main(void) {
+    teste_divisao();
+    teste_vazao();
+    npMultiImprimirVazao(NP_MULTI_MAX_LEDS);
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * teste_serie_ar.c
+ *
+ * O gerador AR(p) em ponto fixo deve ter a autocorrelação do modelo em
+ * ponto flutuante: a das equações de Yule-Walker com os mesmos coeficientes.
+ * Usa os coeficientes do efeito da curva (efeito_curva_ar.c).
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "serie_ar.h"
+
+#define ORDEM 5
+#define AMOSTRAS 400000
+#define ATRASOS 8
+#define TOLERANCIA_RHO 0.01
+#define TOLERANCIA_VARIANCIA 0.03   // Relativa
+
+static const double phi[ORDEM] = { 0.4, -0.2, 0.15, 0.1, 0.05 };
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+// --------------------------------------------------------------
+// rho_k = soma phi_i rho_|k-i|, rho_0 = 1: sistema linear em
+// rho_1..rho_p, resolvido por eliminação de Gauss. Os atrasos
+// maiores seguem a recorrência
+// --------------------------------------------------------------
+static void autocorrelacao_modelo(double *rho, int atrasos) {
+    double a[ORDEM][ORDEM + 1] = { { 0 } };
+
+    for (int k = 1; k <= ORDEM; k++) {
+        a[k - 1][k - 1] += 1.0;
+        for (int i = 1; i <= ORDEM; i++) {
+            int d = k - i < 0 ? i - k : k - i;
+            if (d == 0) a[k - 1][ORDEM] += phi[i - 1];
+            else a[k - 1][d - 1] -= phi[i - 1];
+        }
+    }
+    for (int c = 0; c < ORDEM; c++) {
+        for (int l = c + 1; l < ORDEM; l++) {
+            double f = a[l][c] / a[c][c];
+            for (int j = c; j <= ORDEM; j++) a[l][j] -= f * a[c][j];
+        }
+    }
+    for (int l = ORDEM - 1; l >= 0; l--) {
+        double v = a[l][ORDEM];
+        for (int j = l + 1; j < ORDEM; j++) v -= a[l][j] * rho[j + 1];
+        rho[l + 1] = v / a[l][l];
+    }
+
+    rho[0] = 1.0;
+    for (int k = ORDEM + 1; k <= atrasos; k++) {
+        rho[k] = 0;
+        for (int i = 1; i <= ORDEM; i++) rho[k] += phi[i - 1] * rho[k - i];
+    }
+}
+
+int main(void) {
+    static int16_t serie[AMOSTRAS];
+    int16_t coef[ORDEM];
+    for (int i = 0; i < ORDEM; i++) coef[i] = AR_Q15(phi[i]);
+
+    serie_ar_t gerador;
+    serie_ar_init(&gerador, coef, ORDEM, AR_Q11(1.0), 12345);
+    serie_ar_gerar(&gerador, serie, AMOSTRAS);
+
+    double media = 0;
+    for (int n = 0; n < AMOSTRAS; n++) media += serie[n] / (double)(1 << AR_FRAC_BITS);
+    media /= AMOSTRAS;
+
+    double gama[ATRASOS + 1] = { 0 };
+    for (int k = 0; k <= ATRASOS; k++) {
+        for (int n = k; n < AMOSTRAS; n++) {
+            double x0 = serie[n] / (double)(1 << AR_FRAC_BITS) - media;
+            double x1 = serie[n - k] / (double)(1 << AR_FRAC_BITS) - media;
+            gama[k] += x0 * x1;
+        }
+        gama[k] /= AMOSTRAS;
+    }
+
+    double rho[ATRASOS + 1];
+    autocorrelacao_modelo(rho, ATRASOS);
+
+    printf("atraso  modelo   ponto fixo\n");
+    for (int k = 0; k <= ATRASOS; k++) {
+        double medido = gama[k] / gama[0];
+        printf("%4d  %8.4f  %8.4f\n", k, rho[k], medido);
+        VERIFICAR(fabs(medido - rho[k]) < TOLERANCIA_RHO, "rho[%d] = %.4f, modelo %.4f", k, medido, rho[k]);
+    }
+
+    // Ruído uniforme em [-1, 1): variância 1/3; a do processo é s2 / (1 - soma phi_k rho_k)
+    double soma = 0;
+    for (int k = 1; k <= ORDEM; k++) soma += phi[k - 1] * rho[k];
+    double variancia = (1.0 / 3.0) / (1.0 - soma);
+    printf("variancia: modelo %.4f, ponto fixo %.4f; media %.4f\n", variancia, gama[0], media);
+    VERIFICAR(fabs(gama[0] - variancia) / variancia < TOLERANCIA_VARIANCIA,
+              "variancia %.4f, modelo %.4f", gama[0], variancia);
+    VERIFICAR(fabs(media) < 0.01, "media %.4f", media);
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
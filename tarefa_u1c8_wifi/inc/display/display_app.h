@@ -3,7 +3,7 @@
 #define DISPLAY_APP_H
 
 #include "display/oled_messages.h"
-#include "display/ssd1306_i2c.h"
+#include "ssd1306_i2c.h"
 #include "hardware/i2c.h"
 
 bool display_application_init(uint8_t *buffer_ptr, struct render_area *area_ptr,
@@ -7,14 +7,17 @@
 #include <stdbool.h>
 #include "pico/time.h"
 #include "hardware/i2c.h"
+#include "ssd1306_cena.h"
 
+// A mensagem é um elemento de uma cena retida: o piscar é agendado por alarme
+// e só a linha da mensagem é redesenhada e enviada.
 typedef struct {
     const char *message_active;
     const char *message_inactive;
     int16_t line_y_pixel;
-    uint32_t interval_ms;
-    bool visible;
-    absolute_time_t last_toggle_time;
+    uint32_t interval_ms;           // Meio ciclo do pisca-pisca, em milissegundos
+    ssd1306_cena_t cena;
+    ssd1306_elemento_t *mensagem;
     bool initialized;
     bool active;
     // uint led_pin; // Alternativa: armazenar o pino do LED na struct
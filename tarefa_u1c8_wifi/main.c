@@ -9,7 +9,7 @@
 
 // Módulos da aplicação de Display OLED
 #include "inc/display/display_app.h"   // Funções principais da aplicação do display
-#include "inc/display/ssd1306_i2c.h"   // Definições do driver SSD1306, como tamanho do buffer
+#include "ssd1306_i2c.h"   // Definições do driver SSD1306, como tamanho do buffer
 #include "inc/display/oled_messages.h" // Estrutura e funções para mensagens de alerta no display
 
 // Módulos de Rede e Wi-Fi
@@ -40,7 +40,7 @@
 
 // --- Variáveis Globais Estáticas para o Display OLED ---
 // Buffer para armazenar os dados dos pixels do display OLED
-static uint8_t g_oled_buffer[ssd1306_buffer_length];
+static ssd1306_framebuffer_t g_oled_buffer = SSD1306_FRAMEBUFFER_INIT;
 // Estrutura que define a área de renderização no display
 static struct render_area g_oled_render_area;
 // Estrutura que armazena o estado do alerta piscante no display
@@ -361,7 +361,7 @@ int main() {
     // Inicializa a aplicação do Display OLED
     // As variáveis g_oled_buffer, g_oled_render_area, g_oled_alert_state e g_i2c_port_display
     // são passadas para serem gerenciadas pelo módulo display_app.
-    if (!display_application_init(g_oled_buffer, &g_oled_render_area, &g_oled_alert_state, g_i2c_port_display)) {
+    if (!display_application_init(g_oled_buffer.pixels, &g_oled_render_area, &g_oled_alert_state, g_i2c_port_display)) {
         DEBUG_printf("ERRO: Falha ao inicializar a aplicacao do display!\n");
         // Decide se deve continuar ou parar em caso de falha
     } else {
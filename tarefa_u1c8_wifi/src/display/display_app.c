@@ -6,7 +6,7 @@
 
 // Inclua os cabeçalhos necessários, ajustando os caminhos se necessário
 #include "display/oled_setup.h"    // Para setup_display
-#include "display/ssd1306_i2c.h"   // Para definições do SSD1306 (ou "display/ssd1306.h")
+#include "ssd1306_i2c.h"   // Para definições do SSD1306 (ou "ssd1306.h")
 // oled_messages.h já deve estar incluído por display/display_app.h
 
 // --- Variáveis estáticas para manter o estado da aplicação ---
@@ -1,19 +1,16 @@
 // src/oled_messages.c
 #include "inc/display/oled_messages.h"
-#include "inc/display/ssd1306_text.h"
-#include "inc/display/ssd1306_utils.h"
-#include "inc/display/ssd1306_i2c.h" // Para ssd1306_width (ou o .h que define)
+#include "ssd1306_text.h"
+#include "ssd1306_utils.h"
+#include "ssd1306_init.h"   // ssd1306_padrao_quadro()
+#include "ssd1306_i2c.h" // Para ssd1306_width (ou o .h que define)
 #include "pico/stdlib.h"
 #include "hardware/gpio.h" // <<< NOVO: Para gpio_put
 #include <string.h>
+#include "ssd1306_sem_heap.h"
 
-// Função auxiliar para desenhar mensagem centralizada (mantida como está)
-static void draw_centered_message(uint8_t *buffer, int16_t line_y, const char *message) {
-    if (!message) return;
-    int message_width_pixels = strlen(message) * 8;
-    int16_t start_x = (ssd1306_width - message_width_pixels) / 2;
-    if (start_x < 0) start_x = 0;
-    ssd1306_draw_string(buffer, start_x, line_y, message);
+static uint32_t agora_ms(void) {
+    return to_ms_since_boot(get_absolute_time());
 }
 
 void oled_alert_init(BlinkingAlertState *alert_state,
@@ -31,26 +28,23 @@ void oled_alert_init(BlinkingAlertState *alert_state,
     alert_state->message_inactive = inactive_msg;
     alert_state->line_y_pixel = line_y;
     alert_state->interval_ms = interval_ms;
-    alert_state->visible = true;
-    alert_state->last_toggle_time = get_absolute_time();
     alert_state->active = start_active;
     alert_state->initialized = true;
     // alert_state->led_pin = led_pin; // Se tivesse adicionado à struct
 
-    // Renderização inicial e estado do LED
+    // Primeiro quadro completo: a RAM do display começa com lixo
     oled_clear(buffer, area);
-    if (alert_state->active) {
-        if (alert_state->visible) {
-            draw_centered_message(buffer, alert_state->line_y_pixel, alert_state->message_active);
-            gpio_put(led_pin, 1); // <<< NOVO: Liga o LED
-        } else {
-            gpio_put(led_pin, 0); // <<< NOVO: Desliga o LED
-        }
-    } else {
-        draw_centered_message(buffer, alert_state->line_y_pixel, alert_state->message_inactive);
-        gpio_put(led_pin, 0); // <<< NOVO: Garante que o LED está desligado
-    }
     render_on_display(buffer, area);
+
+    // A mensagem ocupa uma linha centralizada; piscar só quando o alerta está ativo
+    ssd1306_cena_iniciar(&alert_state->cena, ssd1306_padrao_quadro(buffer));
+    alert_state->mensagem = ssd1306_cena_texto(&alert_state->cena, 0, line_y, ssd1306_width, 8,
+                                               start_active ? active_msg : inactive_msg);
+    alert_state->mensagem->centralizar = true;
+    ssd1306_elemento_piscar(alert_state->mensagem, start_active, interval_ms, agora_ms());
+
+    ssd1306_cena_processar(&alert_state->cena);
+    gpio_put(led_pin, start_active); // <<< NOVO: LED acompanha a mensagem
 }
 
 void oled_alert_toggle_active(BlinkingAlertState *alert_state, uint8_t *buffer, struct render_area *area, i2c_inst_t *i2c_port,
@@ -59,22 +53,22 @@ void oled_alert_toggle_active(BlinkingAlertState *alert_state, uint8_t *buffer,
 
     alert_state->active = !alert_state->active;
 
-    oled_clear(buffer, area);
-
     if (alert_state->active) {
         printf("Alerta ATIVADO: %s\n", alert_state->message_active);
-        alert_state->visible = true;
-        alert_state->last_toggle_time = get_absolute_time();
-        draw_centered_message(buffer, alert_state->line_y_pixel, alert_state->message_active);
-        gpio_put(led_pin, 1); // <<< NOVO: Liga o LED
+        ssd1306_elemento_texto(alert_state->mensagem, alert_state->message_active);
     } else {
         printf("Alerta DESATIVADO: %s\n", alert_state->message_inactive);
-        draw_centered_message(buffer, alert_state->line_y_pixel, alert_state->message_inactive);
-        gpio_put(led_pin, 0); // <<< NOVO: Desliga o LED
+        ssd1306_elemento_texto(alert_state->mensagem, alert_state->message_inactive);
     }
-    render_on_display(buffer, area);
+    ssd1306_elemento_piscar(alert_state->mensagem, alert_state->active, alert_state->interval_ms, agora_ms());
+
+    // Só a linha da mensagem é redesenhada e enviada
+    ssd1306_cena_processar(&alert_state->cena);
+    gpio_put(led_pin, alert_state->active); // <<< NOVO: Liga/desliga o LED
 }
 
+// Chamada a cada volta do laço principal: não espera nada. Redesenha só quando
+// o alarme do piscar venceu; retorna true se a tela foi atualizada.
 bool oled_alert_update(uint8_t *buffer, struct render_area *area, i2c_inst_t *i2c_port,
                        BlinkingAlertState *alert_state,
                        uint led_pin) { // <<< NOVO parâmetro
@@ -82,34 +76,10 @@ bool oled_alert_update(uint8_t *buffer, struct render_area *area, i2c_inst_t *i2
         return false;
     }
 
-    if (!alert_state->active) {
-        // Garante que o LED está desligado se o alerta não estiver ativo
-        // (oled_alert_toggle_active já deve ter feito isso, mas por segurança)
-        // gpio_put(led_pin, 0); // Pode ser redundante se toggle_active for robusto
-        return false;
-    }
-
-    absolute_time_t current_time = get_absolute_time();
-    int64_t diff_us = absolute_time_diff_us(alert_state->last_toggle_time, current_time);
-    uint64_t interval_us = (uint64_t)alert_state->interval_ms * 50;
-
-    bool needs_display_refresh = false;
+    bool needs_display_refresh = alert_state->cena.pendente || ssd1306_cena_tem_sujo(&alert_state->cena);
+    ssd1306_cena_processar(&alert_state->cena);
 
-    if (diff_us >= interval_us) {
-        alert_state->visible = !alert_state->visible;
-        alert_state->last_toggle_time = current_time;
-        needs_display_refresh = true;
-    }
-
-     if (needs_display_refresh) {
-        oled_clear(buffer, area);
-        if (alert_state->visible) {
-            draw_centered_message(buffer, alert_state->line_y_pixel, alert_state->message_active);
-            gpio_put(led_pin, 1); // ACENDE O LED
-        } else {
-            gpio_put(led_pin, 0); // APAGA O LED
-        }
-        render_on_display(buffer, area);
-    }
-    return false;
-}
\ No newline at end of file
+    // O LED pisca junto com a mensagem enquanto o alerta está ativo
+    gpio_put(led_pin, alert_state->active && alert_state->mensagem->visivel);
+    return needs_display_refresh;
+}
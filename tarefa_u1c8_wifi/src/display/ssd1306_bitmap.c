@@ -1,8 +0,0 @@
-#include "ssd1306_bitmap.h"
-
-void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
-    for (int i = 0; i < ssd->bufsize - 1; i++) {
-        ssd->ram_buffer[i + 1] = bitmap[i];
-    }
-    ssd1306_send_data(ssd);
-}
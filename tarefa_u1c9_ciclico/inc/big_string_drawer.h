@@ -2,7 +2,9 @@
 #define BIG_STRING_DRAWER_H
 
 #include <stdint.h>
+#include "ssd1306_grande.h"
 
 void draw_big_string_aligned_right(uint8_t *ssd, int y, const char *str);
+void update_big_string_aligned_right(ssd1306_grande_t *grande, const char *str);
 
-#endif
\ No newline at end of file
+#endif
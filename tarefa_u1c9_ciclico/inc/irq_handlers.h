@@ -2,8 +2,10 @@
 #define IRQ_HANDLERS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
-extern volatile bool dma_temp_done;
+extern volatile uint32_t dma_temp_blocos;
+extern volatile uint32_t adc_estouros_fifo;
 void dma_handler_temp(void);
 
 #endif
\ No newline at end of file
@@ -2,33 +2,96 @@
 #define NEOPIXEL_DRIVER_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "hardware/pio.h"
+#include "matriz_led.h"
 
-#define LED_COUNT 25
 #define LED_PIN 7
+
+// Geometria da matriz (pode ser redefinida na compilação, ex.: -DNUM_COLUNAS=8 -DNUM_LINHAS=8).
+#ifndef NUM_COLUNAS
 #define NUM_COLUNAS 5
+#endif
+#ifndef NUM_LINHAS
 #define NUM_LINHAS 5
+#endif
+#define LED_COUNT (NUM_COLUNAS * NUM_LINHAS)
+
+// Ligação física da fita na matriz. O padrão é o da BitDogLab: LED 0 no canto
+// inferior direito e linhas alternando de sentido (serpentina).
+#ifndef NP_LED0_EMBAIXO
+#define NP_LED0_EMBAIXO 1
+#endif
+#ifndef NP_LED0_DIREITA
+#define NP_LED0_DIREITA 1
+#endif
+#ifndef NP_SERPENTINA
+#define NP_SERPENTINA 1
+#endif
+
+// Coordenada lógica (x, y), com y = 0 no topo, para índice na fita. É uma expressão
+// constante: serve para tabelas em tempo de compilação e gera o mapa do driver.
+#define NP_LINHA_FISICA(y) (NP_LED0_EMBAIXO ? (NUM_LINHAS - 1 - (y)) : (y))
+#define NP_LINHA_INVERTIDA(lf) (NP_LED0_DIREITA ^ (NP_SERPENTINA && ((lf) & 1)))
+#define NP_XY(x, y) (NP_LINHA_FISICA(y) * NUM_COLUNAS + \
+                     (NP_LINHA_INVERTIDA(NP_LINHA_FISICA(y)) ? (NUM_COLUNAS - 1 - (x)) : (x)))
 #define COR_APAGA   0
 #define COR_MIN     64
 #define COR_INTER   128
 #define COR_ALTA    192
 
 
-typedef struct {
-    uint8_t G, R, B;
-} npLED_t;
+// Tempo mínimo entre o fim do DMA e o próximo quadro: esvaziar o FIFO
+// (8 palavras x 30 us) mais o sinal de RESET (>= 100 us) do datasheet.
+#define NP_TEMPO_LATCH_US 400
+
+// Callback chamado (em contexto de IRQ) quando o DMA termina de alimentar o PIO.
+typedef void (*npCallbackQuadro_t)(void);
 
-extern npLED_t leds[LED_COUNT];
+// Buffer de composição (back buffer). Aponta para um dos dois quadros internos
+// e troca de lado a cada np_commit_frame(); o quadro exibido (front) fica no driver.
+extern npLED_t *leds;
 extern PIO np_pio;
 extern int sm;
+extern volatile bool np_quadro_concluido;
 
+void npPrepararDriver(void);
 void npInit(uint pin);
+int npOffsetPrograma(PIO pio);
+npLED_t *np_begin_frame(void);
+void np_commit_frame(void);
+bool np_present_frame(void);
 void npWrite(void);
+bool npWriteAsync(void);
+bool npQuadroEmAndamento(void);
+void npAguardarQuadro(void);
+void npSetCallbackQuadro(npCallbackQuadro_t cb);
+void npSetBrilho(uint8_t brilho);
+void npSetGamma(bool ativo);
+void npEmpacotar(const npLED_t *origem, uint32_t *destino, uint n);
 void npWriteComBrilho(float brilho);
-void npSetLED(uint8_t index, uint8_t r, uint8_t g, uint8_t b);
+void npSetLED(uint16_t index, uint8_t r, uint8_t g, uint8_t b);
+void npSetLinha(uint y, uint8_t r, uint8_t g, uint8_t b);
+void npSetColuna(uint x, uint8_t r, uint8_t g, uint8_t b);
 void npSetAll(uint8_t r, uint8_t g, uint8_t b);
 void npClear(void);
 void liberar_maquina_pio(PIO pio, uint sm);
 uint getLEDIndex(uint x, uint y);
 
+// Mapa (x, y) -> índice na fita, preenchido com NP_XY em npInit.
+extern uint16_t np_mapa[NUM_LINHAS][NUM_COLUNAS];
+
+// Índices na fita em ordem de espiral (borda para o centro), gerados em npInit
+// a partir da geometria; a espiral inversa percorre o vetor de trás para frente.
+extern uint16_t np_espiral[LED_COUNT];
+
+// Geometria para o motor de efeitos (bibliotecas/motor_efeitos): aponta para np_mapa
+// e np_espiral, válidos depois de npPrepararDriver/npInit.
+extern const matriz_led_t np_matriz;
+
+// Versão sem verificação de limites para laços internos dos efeitos.
+static inline uint npIndice(uint x, uint y) {
+    return np_mapa[y][x];
+}
+
 #endif
\ No newline at end of file
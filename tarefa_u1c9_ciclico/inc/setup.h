@@ -4,8 +4,10 @@
 #include "hardware/dma.h"
 
 #define DMA_TEMP_CHANNEL 0
+#define DMA_TEMP_CHANNEL_B 1    // Par do canal 0 na captura em ping-pong
 
 extern dma_channel_config cfg_temp;
+extern dma_channel_config cfg_temp_b;
 
 void setup(void);
 
@@ -0,0 +1,62 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: tarefa1_anel.h
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Consumo das duas metades do buffer ping-pong da Tarefa 1,
+ *      sem depender do hardware: o DMA (ou um teste no host)
+ *      enche as metades alternadamente e conta as concluídas;
+ *      este módulo as passa ao decimador na ordem, detecta as
+ *      reescritas antes de filtradas e nunca espera.
+ *
+ *  
+ *  Data: 11/05/2025
+ * ------------------------------------------------------------
+ */
+
+#ifndef TAREFA1_ANEL_H
+#define TAREFA1_ANEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_decimador.h"
+
+typedef struct {
+    const uint16_t *metades[2];             // Metade 0 recebe as concluídas pares
+    uint32_t bloco_amostras;                // Amostras por metade
+    const volatile uint32_t *concluidas;    // Metades terminadas (contador do handler)
+    uint32_t proxima;                       // Próxima metade a filtrar
+    adc_decimador_t decimador;
+    uint32_t blocos_filtrados;
+    uint32_t amostras_perdidas;             // Reescritas antes de filtradas
+} tarefa1_anel_t;
+
+/**
+ * @brief Prepara o consumo a partir da metade em preenchimento agora.
+ *
+ * @param anel Estado do consumidor
+ * @param metade_0 Metade escrita primeiro
+ * @param metade_1 Metade par
+ * @param bloco_amostras Amostras por metade
+ * @param concluidas Contador de metades concluídas, atualizado pelo produtor
+ * @param log2_decimacao Amostras por saída (2^log2) no boxcar
+ */
+void tarefa1_anel_iniciar(tarefa1_anel_t *anel, const uint16_t *metade_0, const uint16_t *metade_1,
+                          uint32_t bloco_amostras, const volatile uint32_t *concluidas,
+                          uint8_t log2_decimacao);
+
+/**
+ * @brief Filtra todas as metades prontas e retorna sem esperar.
+ *
+ * Se o produtor passou mais de uma metade à frente, as antigas já foram
+ * reescritas: entram como perdidas e a janela do filtro recomeça, para a
+ * média nunca ter buracos.
+ *
+ * @param anel Estado do consumidor
+ * @param codigo Recebe a última saída, em Q12.F (F = decimador.bits_frac)
+ * @return true se saiu ao menos uma média nesta chamada
+ */
+bool tarefa1_anel_consumir(tarefa1_anel_t *anel, int32_t *codigo);
+
+#endif
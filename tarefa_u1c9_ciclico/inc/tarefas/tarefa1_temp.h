@@ -1,8 +1,20 @@
 #ifndef TAREFA1_TEMP_H
 #define TAREFA1_TEMP_H
 
+#include <stdint.h>
+#include <stdbool.h>
 #include "hardware/dma.h"
 
-float tarefa1_obter_media_temp(dma_channel_config* cfg, int dma_chan);
+// Contadores da captura contínua, acumulados desde o início.
+typedef struct {
+    uint32_t blocos_filtrados;      // Metades do buffer filtradas
+    uint32_t amostras_perdidas;     // Reescritas pelo DMA antes de serem filtradas
+    uint32_t estouros_fifo;         // FIFO do ADC cheia (o DMA não acompanhou)
+} tarefa1_perdas_t;
 
-#endif
\ No newline at end of file
+void tarefa1_iniciar_captura(dma_channel_config *cfg_a, int canal_a,
+                             dma_channel_config *cfg_b, int canal_b);
+bool tarefa1_processar_temp(int32_t *media_mc);   // Não bloqueia; média em m°C
+tarefa1_perdas_t tarefa1_obter_perdas(void);
+
+#endif
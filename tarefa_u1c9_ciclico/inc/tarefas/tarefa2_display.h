@@ -26,4 +26,11 @@
  */
 void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia);
 
+/**
+ * @brief Acrescenta uma leitura da Tarefa 1 ao gráfico de temperatura.
+ *
+ * @param temperatura Média recém-obtida por tarefa1_processar_temp()
+ */
+void tarefa2_registrar_amostra(float temperatura);
+
 #endif  // TAREFA2_DISPLAY_H
@@ -9,7 +9,11 @@
  *
  *      Fornece:
  *        - Enumeração `tendencia_t` com os três estados possíveis
+ *        - Motor de tendência: regressão linear móvel sobre uma
+ *          janela de amostras, com histerese, em tempo constante
+ *          e sem alocação
  *        - Função para determinar a tendência com base na temperatura atual
+ *        - Inclinação em °C/min para o OLED e o NeoPixel
  *        - Função para converter a tendência em texto
  *
  *  
@@ -20,10 +24,15 @@
 #ifndef TAREFA3_TENDENCIA_H
 #define TAREFA3_TENDENCIA_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define TENDENCIA_JANELA_MAX 64
+#define TENDENCIA_PERIODO_MS 1200   // Uma média da Tarefa 1 por disparo do Timer A
+
 // Enumeração da tendência térmica
 typedef enum {
     TENDENCIA_ESTÁVEL,
@@ -31,13 +40,61 @@ typedef enum {
     TENDENCIA_CAINDO
 } tendencia_t;
 
+// Regressão linear das últimas 'janela' amostras (em milésimos de grau), com
+// as somas atualizadas a cada amostra: a que sai da janela é descontada, sem
+// percorrer o anel. As somas são inteiras e não acumulam erro.
+typedef struct {
+    int32_t amostras[TENDENCIA_JANELA_MAX];     // Anel (m°C)
+    uint8_t janela;
+    uint8_t quantidade;                         // Amostras na janela
+    uint8_t inicio;                             // Mais antiga
+    int64_t soma_y;                             // Σ y
+    int64_t soma_xy;                            // Σ x·y, x = 0 na mais antiga
+    float escala;                               // °C/min por m°C/amostra
+    float limiar_entrada;                       // °C/min para sair de ESTÁVEL
+    float limiar_saida;                         // °C/min para voltar a ESTÁVEL
+    float inclinacao;                           // °C/min
+    tendencia_t estado;
+} tendencia_motor_t;
+
 /**
- * @brief Analisa a tendência com base na temperatura atual e anterior.
+ * @brief Prepara o motor com a janela vazia e a tendência ESTÁVEL.
  *
- * @param atual Temperatura atual (ºC)
+ * @param motor Estado do motor (do chamador, sem alocação)
+ * @param janela Amostras na regressão (2 a TENDENCIA_JANELA_MAX)
+ * @param periodo_ms Intervalo entre amostras
+ * @param limiar_entrada Inclinação (°C/min) que inicia SUBINDO/CAINDO
+ * @param limiar_saida Inclinação (°C/min) abaixo da qual volta a ESTÁVEL
+ */
+void tendencia_motor_iniciar(tendencia_motor_t *motor, uint8_t janela, uint32_t periodo_ms,
+                             float limiar_entrada, float limiar_saida);
+
+/**
+ * @brief Acrescenta uma amostra e reclassifica, em tempo constante.
+ *
+ * Até a janela chegar à metade (e ter ao menos 2 amostras) a tendência
+ * fica ESTÁVEL: com poucos pontos a reta ainda segue o ruído.
+ *
+ * @param motor Estado do motor
+ * @param mili_celsius Temperatura em milésimos de grau
  * @return tendência identificada
  */
-tendencia_t tarefa3_analisa_tendencia(float atual);
+tendencia_t tendencia_motor_adicionar(tendencia_motor_t *motor, int32_t mili_celsius);
+
+/**
+ * @brief Analisa a tendência das últimas médias (motor da Tarefa 3).
+ *
+ * @param mili_celsius Média da Tarefa 1, em milésimos de grau
+ * @return tendência identificada
+ */
+tendencia_t tarefa3_analisa_tendencia(int32_t mili_celsius);
+
+/**
+ * @brief Inclinação da última análise, para o OLED e o NeoPixel.
+ *
+ * @return Variação da temperatura em °C por minuto
+ */
+float tarefa3_inclinacao_c_min(void);
 
 /**
  * @brief Converte a tendência para texto ("SUBINDO", "CAINDO", "ESTÁVEL").
@@ -8,8 +8,10 @@
  *      Tarefas escalonadas por timers do RP2040, com I/O no loop principal.
  *
  *      Fluxo:
- *      1. Timer A sinaliza (flag) para Tarefa 1 (leitura de temperatura) no main.
- *      2. Tarefa 1 no main atualiza 'media' e sinaliza (flag) dados prontos.
+ *      1. Tarefa 1 roda a cada volta do main sem bloquear: filtra as
+ *         metades do DMA prontas e guarda a última média em 'ultima_media_mc'.
+ *      2. Timer A sinaliza (flag); o main publica a última média em
+ *         'media' e sinaliza (flag) dados prontos.
  *      3. Timer B verifica dados prontos e sinaliza (flag) para o main processar
  *         as "demais tarefas" (análise, OLED, NeoPixel, extra).
  *      4. Main executa I/O e lógica quando flags ativas; dorme (__wfi()) ocioso.
@@ -23,7 +25,7 @@
  *          das "demais tarefas" (análise no callback, I/O sinalizada para o main).
  *      - repeating_timer_callback para a Tarefa 1:
  *          Timer A usa 'callback_disparar_leitura_temp' para sinalizar (flag)
- *          a execução da Tarefa 1 no main.
+ *          que o main deve publicar a média da Tarefa 1.
  * ------------------------------------------------------------
  */
 
@@ -45,14 +47,25 @@
 
 // --- Variáveis Globais ---
 float media;     // Média da temperatura (Tarefa 1).
+int32_t media_mc;    // A mesma média em milésimos de grau, para a Tarefa 3.
+int32_t ultima_media_mc;     // Última saída da Tarefa 1, em milésimos de grau.
+bool media_mc_valida = false; // Já saiu a primeira média.
 tendencia_t t; // Tendência térmica (Tarefa 3).
 
 // --- Flags de Controle (volatile: acesso por ISR e main) ---
-volatile bool flag_main_deve_ler_temp = true;             // Timer A: main deve iniciar Tarefa 1.
+volatile bool flag_main_deve_ler_temp = true;             // Timer A: main deve publicar a média.
 volatile bool flag_media_foi_lida_e_esta_pronta = false;  // Main: Tarefa 1 concluída, 'media' pronta.
 volatile bool flag_main_deve_processar_dependentes = false; // Timer B: main deve processar tarefas 2,3,4,5.
 
 
+// Tarefa 1: filtra as metades prontas do DMA (nunca espera). Chamada pelo
+// main a cada volta e entre as tarefas de I/O, que podem passar de uma metade.
+void executar_tarefa_1_no_main_loop() {
+    if (tarefa1_processar_temp(&ultima_media_mc)) {
+        media_mc_valida = true;
+    }
+}
+
 // Tarefa 5: Animação NeoPixel. Chamada pelo main.
 void executar_logica_tarefa_5_no_main_loop() {
     static uint8_t t5_counter = 0; // Alterna efeito.
@@ -69,11 +82,11 @@ void executar_logica_tarefa_5_no_main_loop() {
 
 // --- Callbacks dos Timers (Executados em Interrupção) ---
 
-// Timer A Callback: Sinaliza para main iniciar leitura de temperatura.
+// Timer A Callback: Sinaliza para main publicar a média de temperatura.
 bool callback_disparar_leitura_temp(struct repeating_timer *rt) {
     // Só sinaliza se não houver leitura pendente ou dados não processados.
     if (!flag_main_deve_ler_temp && !flag_media_foi_lida_e_esta_pronta) {
-        flag_main_deve_ler_temp = true; // Avisa main para executar Tarefa 1.
+        flag_main_deve_ler_temp = true; // Avisa main para publicar a média.
     }
     return true; // Continua o timer.
 }
@@ -93,9 +106,9 @@ int main() {
 
     // watchdog_enable(3000, 1); // Opcional: habilita watchdog.
 
-    // Configura Timer A (dispara Tarefa 1 via main).
+    // Configura Timer A (publica a média da Tarefa 1 via main).
     struct repeating_timer timer_t1_obj;
-    if (!add_repeating_timer_ms(-1200, callback_disparar_leitura_temp, NULL, &timer_t1_obj)) {
+    if (!add_repeating_timer_ms(-TENDENCIA_PERIODO_MS, callback_disparar_leitura_temp, NULL, &timer_t1_obj)) {
         while(1){ /* Erro Timer A */ } // Trava em caso de erro.
     }
 
@@ -109,10 +122,14 @@ int main() {
     while (true) {
         // watchdog_update(); // Opcional: alimenta watchdog.
 
-        // Se Timer A sinalizou para Tarefa 1.
-        if (flag_main_deve_ler_temp) {
+        executar_tarefa_1_no_main_loop(); // Tarefa 1: nunca espera.
+
+        // Se Timer A sinalizou e já há uma média da Tarefa 1.
+        if (flag_main_deve_ler_temp && media_mc_valida) {
             flag_main_deve_ler_temp = false; // Consome flag.
-            media = tarefa1_obter_media_temp(&cfg_temp, DMA_TEMP_CHANNEL); // Executa Tarefa 1.
+            media_mc = ultima_media_mc;      // Última média da Tarefa 1.
+            media = media_mc / 1000.0f;
+            tarefa2_registrar_amostra(media);       // Nova coluna no gráfico do OLED.
             flag_media_foi_lida_e_esta_pronta = true; // 'media' pronta para Tarefas Dependentes.
         }
 
@@ -120,8 +137,9 @@ int main() {
         if (flag_main_deve_processar_dependentes) {
             flag_main_deve_processar_dependentes = false; // Consome flag.
             
-            t = tarefa3_analisa_tendencia(media);   // Tarefa 3: Análise.
+            t = tarefa3_analisa_tendencia(media_mc); // Tarefa 3: Análise (inteira).
             tarefa2_exibir_oled(media, t);          // Tarefa 2: OLED.
+            executar_tarefa_1_no_main_loop();       // Metades prontas durante o I2C.
             tarefa4_matriz_cor_por_tendencia(t);    // Tarefa 4: NeoPixel.
             executar_logica_tarefa_5_no_main_loop(); // Tarefa 5: Extra.
             
@@ -130,12 +148,15 @@ int main() {
             // Diagnóstico opcional (manter comentado para teste inicial).
             // static uint32_t diag_cnt = 0;
             // if (stdio_usb_connected()) {
-            //    printf("[%lu] T:%.2fC (%s)\n", diag_cnt++, media, tendencia_para_texto(t));
+            //    tarefa1_perdas_t perdas = tarefa1_obter_perdas();
+            //    printf("[%lu] T:%.2fC (%s) perdidas:%lu fifo:%lu\n", diag_cnt++, media,
+            //           tendencia_para_texto(t), perdas.amostras_perdidas, perdas.estouros_fifo);
             // }
         }
 
         // Se não há trabalho imediato e 'media' não está pendente, economiza energia.
-        if (!flag_main_deve_ler_temp && 
+        // A interrupção de cada metade do DMA (8 ms) acorda a Tarefa 1.
+        if ((!flag_main_deve_ler_temp || !media_mc_valida) &&
             !flag_main_deve_processar_dependentes &&
             !flag_media_foi_lida_e_esta_pronta) {
             __wfi(); // Dorme até próxima interrupção (timer).
@@ -1,7 +1,20 @@
 #include "inc/font_big_logo.h"
 #include "inc/draw_big_char.h"
+#include "inc/big_string_drawer.h"
 #include <stddef.h>
 
+// Os bitmaps têm 32 linhas de 16 bits (bit 7 do 1º byte = coluna 0), mas só as
+// linhas 0 a 15 têm pixels acesos: o cache guarda essas duas páginas.
+#define BIG_PAGINAS 2
+#define BIG_SIMBOLOS 15
+
+static const char big_simbolos[BIG_SIMBOLOS + 1] = "0123456789+-.oC";
+
+// Colunas de página de cada símbolo, convertidas uma vez dos bitmaps
+static uint8_t big_colunas[BIG_SIMBOLOS][16 * BIG_PAGINAS];
+static ssd1306_glifo_grande_t big_glifos[BIG_SIMBOLOS];
+static bool big_cache_pronto = false;
+
 const uint8_t* get_big_bitmap(char c) {
     switch (c) {
         case '0': return big_digit_0;
@@ -42,15 +55,69 @@ int calc_string_width(const char *str) {
     return width;
 }
 
+// Transpõe as linhas do bitmap para bytes de página (bit 0 = linha de cima).
+static void preparar_cache(void) {
+    for (int s = 0; s < BIG_SIMBOLOS; s++) {
+        const uint8_t *bitmap = get_big_bitmap(big_simbolos[s]);
+
+        for (int col = 0; col < 16; col++) {
+            for (int page = 0; page < BIG_PAGINAS; page++) {
+                uint8_t byte = 0;
+                for (int bit = 0; bit < 8; bit++) {
+                    int row = page * 8 + bit;
+                    byte |= ((bitmap[row * 2 + col / 8] >> (7 - col % 8)) & 0x01) << bit;
+                }
+                big_colunas[s][col * BIG_PAGINAS + page] = byte;
+            }
+        }
+
+        big_glifos[s].largura = get_char_width(big_simbolos[s]);
+        big_glifos[s].paginas = BIG_PAGINAS;
+        big_glifos[s].passo = BIG_PAGINAS;
+        big_glifos[s].colunas = big_colunas[s];
+    }
+    big_cache_pronto = true;
+}
+
+const ssd1306_glifo_grande_t *get_big_glyph(char c) {
+    if (!big_cache_pronto) preparar_cache();
+
+    for (int s = 0; s < BIG_SIMBOLOS; s++) {
+        if (big_simbolos[s] == c) return &big_glifos[s];
+    }
+    return NULL;
+}
+
 void draw_big_string_aligned_right(uint8_t *ssd, int y, const char *str) {
     int width = calc_string_width(str);
     int x = 128 - width;
     while (*str) {
-        const uint8_t *bitmap = get_big_bitmap(*str);
-        if (bitmap) {
-            draw_big_char(ssd, x, y, bitmap);
+        const ssd1306_glifo_grande_t *glifo = get_big_glyph(*str);
+        if (glifo && y % 8 == 0) {
+            // Alinhado às páginas: copia as colunas do cache
+            ssd1306_dev_glifo_grande(ssd1306_padrao_quadro(ssd), x, y / 8, glifo);
+        } else if (glifo) {
+            draw_big_char(ssd, x, y, get_big_bitmap(*str));
         }
         x += get_char_width(*str);
         str++;
     }
 }
+
+// Mesma disposição de draw_big_string_aligned_right(), mas redesenha só os
+// símbolos que mudaram desde a última chamada com o mesmo 'grande'.
+void update_big_string_aligned_right(ssd1306_grande_t *grande, const char *str) {
+    int16_t x[SSD1306_GRANDE_MAX];
+    const ssd1306_glifo_grande_t *glifos[SSD1306_GRANDE_MAX];
+    int quantidade = 0;
+
+    int coluna = 128 - calc_string_width(str);
+    while (*str && quantidade < SSD1306_GRANDE_MAX) {
+        x[quantidade] = coluna;
+        glifos[quantidade] = get_big_glyph(*str);
+        quantidade++;
+        coluna += get_char_width(*str);
+        str++;
+    }
+    ssd1306_grande_exibir(grande, x, glifos, quantidade);
+}
@@ -1,10 +1,21 @@
 #include <stdio.h>
 #include <stdint.h>
+#include "ssd1306.h"
 #include "inc/display_utils.h"
 #include "inc/big_string_drawer.h"
 
+// 'y' múltiplo de 8: o valor fica alinhado às páginas e, de uma chamada para a
+// outra, só os dígitos que mudaram são apagados e redesenhados.
 void mostrar_valor_grande(uint8_t *ssd, float valor, int y) {
+    static ssd1306_grande_t valor_grande;
+    static int y_atual = -1;
+
     char buffer[16];
     snprintf(buffer, sizeof(buffer), "%+.2foC", valor);
-    draw_big_string_aligned_right(ssd, y, buffer);
-}
\ No newline at end of file
+
+    if (y != y_atual) {
+        ssd1306_grande_iniciar(&valor_grande, ssd1306_padrao_quadro(ssd), y / 8);
+        y_atual = y;
+    }
+    update_big_string_aligned_right(&valor_grande, buffer);
+}
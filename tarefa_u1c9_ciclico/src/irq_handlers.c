@@ -4,42 +4,59 @@
  *  Projeto: TempCycleDMA
  * ------------------------------------------------------------
  *  Descrição:
- *      Este arquivo implementa o handler de interrupção do
- *      canal DMA 0, utilizado para leitura do sensor interno
- *      de temperatura via ADC do Raspberry Pi Pico W.
+ *      Este arquivo implementa o handler de interrupção dos
+ *      canais DMA 0 e 1, que se alternam (ping-pong) na leitura
+ *      contínua do sensor interno de temperatura via ADC do
+ *      Raspberry Pi Pico W.
  *
  *      A função 'dma_handler_temp()' é responsável por
  *      capturar a interrupção do DMA, limpar o status e
- *      sinalizar a finalização da transferência de dados
- *      via flag global 'dma_temp_done'.
+ *      contar as metades concluídas no contador global
+ *      'dma_temp_blocos'. Os canais não precisam ser rearmados:
+ *      um encadeia o outro e o endereço de escrita de cada um
+ *      dá a volta sozinho (anel) na sua metade do buffer.
  *
  *  Relacionamento:
  *      - Este handler é registrado em 'setup.c' usando:
  *            irq_set_exclusive_handler(DMA_IRQ_0, dma_handler_temp);
- *      - A flag 'dma_temp_done' é usada em 'tarefa1_temp.c'
- *        para controlar o fluxo da aquisição via DMA.
+ *      - O contador 'dma_temp_blocos' é usado em 'tarefa1_temp.c'
+ *        para consumir as metades prontas e detectar perdas.
  *
  *  
  *  Data: 11/05/2025
  * ------------------------------------------------------------
  */
 
+#include "hardware/adc.h"
 #include "hardware/dma.h"
 #include "inc/irq_handlers.h"
+#include "inc/setup.h"
 
-// Flag global que sinaliza a conclusão da transferência DMA
-volatile bool dma_temp_done = false;
+// Metades do buffer concluídas desde o início da captura (a paridade diz qual)
+volatile uint32_t dma_temp_blocos = 0;
+
+// Vezes que a FIFO do ADC transbordou (o DMA não acompanhou o ADC)
+volatile uint32_t adc_estouros_fifo = 0;
 
 /**
- * @brief Handler de interrupção do canal DMA 0.
+ * @brief Handler de interrupção dos canais DMA 0 e 1.
  *
- * Esta função é chamada automaticamente quando o canal 0 do DMA
- * completa a transferência das amostras do ADC para o buffer.
- * Ela limpa a flag da interrupção e ativa o sinalizador
- * 'dma_temp_done' para que o laço principal saiba que pode
- * prosseguir.
+ * Esta função é chamada automaticamente quando um dos canais
+ * completa a sua metade do buffer. O outro canal já começou
+ * (encadeamento), então aqui só se limpa a interrupção e se
+ * conta a metade pronta para o laço principal.
  */
 void dma_handler_temp() {
-    dma_hw->ints0 = 1u << 0;   // Limpa a interrupção do canal 0
-    dma_temp_done = true;     // Sinaliza conclusão para o executor
-}
\ No newline at end of file
+    uint32_t canais = (1u << DMA_TEMP_CHANNEL) | (1u << DMA_TEMP_CHANNEL_B);
+    uint32_t pendentes = dma_hw->ints0 & canais;
+    dma_hw->ints0 = pendentes;   // Limpa a interrupção dos canais
+
+    // Com atraso no atendimento, as duas metades podem ter terminado
+    if (pendentes & (1u << DMA_TEMP_CHANNEL)) dma_temp_blocos++;
+    if (pendentes & (1u << DMA_TEMP_CHANNEL_B)) dma_temp_blocos++;
+
+    if (adc_hw->fcs & ADC_FCS_OVER_BITS) {
+        adc_hw->fcs = ADC_FCS_OVER_BITS;    // Limpa (escrita de 1)
+        adc_estouros_fifo++;
+    }
+}
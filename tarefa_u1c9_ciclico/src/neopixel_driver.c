@@ -1,39 +1,287 @@
 #include "neopixel_driver.h"
 #include "ws2818b.pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "pico/time.h"
+#include "pico/sync.h"
+#include <string.h>
 
-npLED_t leds[LED_COUNT];
+// Dois quadros: um é composto pelos efeitos (back), o outro é o último publicado (front).
+static npLED_t np_buffers[2][LED_COUNT];
+static volatile uint8_t np_front = 0;
+static critical_section_t np_lock;   // Protege a troca e o empacotamento entre núcleos
+static volatile bool np_quadro_pendente = false;
+
+npLED_t *leds = np_buffers[1];
 PIO np_pio;
 int sm;
+static int np_offset = -1;          // Onde npInit carregou o ws2818b no pio0
+
+uint16_t np_mapa[NUM_LINHAS][NUM_COLUNAS];
+uint16_t np_espiral[LED_COUNT];
+const matriz_led_t np_matriz = { NUM_COLUNAS, NUM_LINHAS, &np_mapa[0][0], np_espiral };
+
+// Sinaliza que o último quadro assíncrono terminou de ser entregue ao PIO.
+volatile bool np_quadro_concluido = true;
+
+// Quadro empacotado (uma palavra GRB de 24 bits por LED) lido pelo DMA.
+static uint32_t np_quadro[LED_COUNT];
+static int np_dma_chan = -1;
+static volatile bool np_dma_ocupado = false;
+static volatile uint64_t np_fim_envio_us = 0;
+static npCallbackQuadro_t np_callback = NULL;
+
+// Curva gama 2,8 (brilho percebido): índice = valor linear, conteúdo = valor enviado ao LED.
+static const uint8_t np_gamma[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      2,   3,   3,   3,   3,   3,   3,   3,   4,   4,   4,   4,   4,   5,   5,   5,
+      5,   6,   6,   6,   6,   7,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,
+     10,  10,  11,  11,  11,  12,  12,  13,  13,  13,  14,  14,  15,  15,  16,  16,
+     17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  24,  24,  25,
+     25,  26,  27,  27,  28,  29,  29,  30,  31,  32,  32,  33,  34,  35,  35,  36,
+     37,  38,  39,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  50,
+     51,  52,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  66,  67,  68,
+     69,  70,  72,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,
+     90,  92,  93,  95,  96,  98,  99, 101, 102, 104, 105, 107, 109, 110, 112, 114,
+    115, 117, 119, 120, 122, 124, 126, 127, 129, 131, 133, 135, 137, 138, 140, 142,
+    144, 146, 148, 150, 152, 154, 156, 158, 160, 162, 164, 167, 169, 171, 173, 175,
+    177, 180, 182, 184, 186, 189, 191, 193, 196, 198, 200, 203, 205, 208, 210, 213,
+    215, 218, 220, 223, 225, 228, 231, 233, 236, 239, 241, 244, 247, 249, 252, 255,
+};
+
+// Tabela efetiva aplicada no empacotamento: gama (opcional) seguida do brilho global.
+// Recalculada só quando o brilho ou a gama mudam; por LED resta uma consulta por canal.
+static uint8_t np_lut[256];
+static uint8_t np_brilho = 255;
+static bool np_gamma_ativo = false;
+
+static void np_atualizar_lut(void) {
+    for (uint v = 0; v < 256; ++v) {
+        uint base = np_gamma_ativo ? np_gamma[v] : v;
+        np_lut[v] = (base * (np_brilho + 1u)) >> 8;
+    }
+}
+
+// Monta a palavra no formato esperado pelo PIO (deslocamento à direita, 24 bits):
+// o byte G sai primeiro, depois R e por último B.
+static inline uint32_t np_empacotar(const npLED_t *led) {
+    return (uint32_t)np_lut[led->G] | ((uint32_t)np_lut[led->R] << 8) | ((uint32_t)np_lut[led->B] << 16);
+}
+
+// Mesma palavra com um fator extra em Q8 (256 = 1,0), aplicado por multiplicação e deslocamento.
+static inline uint32_t np_empacotar_escala(const npLED_t *led, uint32_t escala) {
+    return ((np_lut[led->G] * escala) >> 8) |
+           (((np_lut[led->R] * escala) >> 8) << 8) |
+           (((np_lut[led->B] * escala) >> 8) << 16);
+}
+
+// Empacota o quadro publicado (front); a trava impede uma troca no meio da leitura.
+static void np_empacotar_quadro(void) {
+    critical_section_enter_blocking(&np_lock);
+    const npLED_t *front = np_buffers[np_front];
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        np_quadro[i] = np_empacotar(&front[i]);
+    }
+    np_quadro_pendente = false;
+    critical_section_exit(&np_lock);
+}
+
+// Empacota 'n' LEDs quaisquer no formato do PIO, com a mesma tabela de gama/brilho.
+// Roda sob a trava de np_commit_frame: a tabela não muda no meio e quem compõe
+// em outro núcleo sob a mesma trava nunca tem o quadro lido pela metade.
+void npEmpacotar(const npLED_t *origem, uint32_t *destino, uint n) {
+    critical_section_enter_blocking(&np_lock);
+    for (uint i = 0; i < n; ++i) {
+        destino[i] = np_empacotar(&origem[i]);
+    }
+    critical_section_exit(&np_lock);
+}
+
+// Handler do DMA_IRQ_1 (compartilhado): o DMA_IRQ_0 fica livre para outros módulos.
+static void np_dma_handler(void) {
+    if (np_dma_chan < 0 || !dma_channel_get_irq1_status(np_dma_chan)) return;
+
+    dma_channel_acknowledge_irq1(np_dma_chan);
+    np_fim_envio_us = time_us_64();
+    np_dma_ocupado = false;
+    np_quadro_concluido = true;
+
+    if (np_callback) np_callback();
+}
+
+static void np_dma_init(void) {
+    np_dma_chan = dma_claim_unused_channel(true);
+
+    dma_channel_config cfg = dma_channel_get_default_config(np_dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);    // Uma palavra por LED
+    channel_config_set_read_increment(&cfg, true);               // Percorre o quadro
+    channel_config_set_write_increment(&cfg, false);             // FIFO TX fixo
+    channel_config_set_dreq(&cfg, pio_get_dreq(np_pio, sm, true)); // Ritmo ditado pelo PIO
+
+    dma_channel_configure(np_dma_chan, &cfg, &np_pio->txf[sm], np_quadro, LED_COUNT, false);
+
+    dma_channel_set_irq1_enabled(np_dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_1, np_dma_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+}
+
+static void np_mapa_init(void) {
+    for (uint y = 0; y < NUM_LINHAS; ++y) {
+        for (uint x = 0; x < NUM_COLUNAS; ++x) {
+            np_mapa[y][x] = NP_XY(x, y);
+        }
+    }
+}
+
+// Espiral do canto superior esquerdo ao centro, gerada para qualquer
+// NUM_COLUNAS x NUM_LINHAS: contorna a borda e fecha o retângulo a cada volta.
+static void np_espiral_init(void) {
+    int x0 = 0, y0 = 0, x1 = NUM_COLUNAS - 1, y1 = NUM_LINHAS - 1;
+    uint n = 0;
+
+    while (x0 <= x1 && y0 <= y1) {
+        for (int x = x0; x <= x1; ++x)                 np_espiral[n++] = np_mapa[y0][x];
+        for (int y = y0 + 1; y <= y1; ++y)             np_espiral[n++] = np_mapa[y][x1];
+        if (y0 < y1) for (int x = x1 - 1; x >= x0; --x) np_espiral[n++] = np_mapa[y1][x];
+        if (x0 < x1) for (int y = y1 - 1; y > y0; --y)  np_espiral[n++] = np_mapa[y][x0];
+        x0++; y0++; x1--; y1--;
+    }
+}
+
+// Trava, tabela de gama/brilho e mapa de coordenadas. Pode ser chamada mais de uma vez
+// (npInit e o modo de múltiplas fitas usam).
+void npPrepararDriver(void) {
+    static bool pronto = false;
+    if (pronto) return;
+    critical_section_init(&np_lock);
+    np_atualizar_lut();
+    np_mapa_init();
+    np_espiral_init();
+    pronto = true;
+}
 
 void npInit(uint pin) {
-    uint offset = pio_add_program(pio0, &ws2818b_program);
+    npPrepararDriver();
+    if (np_offset < 0) np_offset = pio_add_program(pio0, &ws2818b_program);
+    uint offset = np_offset;
     np_pio = pio0;
-    sm = 0; // Usar SM 0 fixamente
-    pio_sm_claim(np_pio, sm);
+    sm = pio_claim_unused_sm(np_pio, true); // Deixa as demais SMs livres para outras fitas
     ws2818b_program_init(np_pio, sm, offset, pin, 800000.f);
+    np_dma_init();
     npClear();
 }
 
+// Offset do ws2818b já carregado em 'pio' por npInit, ou -1: outros modos
+// reaproveitam o programa em vez de ocupar a memória de instruções de novo.
+int npOffsetPrograma(PIO pio) {
+    return pio == pio0 ? np_offset : -1;
+}
+
+// Devolve o back buffer, que já contém o último quadro publicado, para compor o próximo.
+npLED_t *np_begin_frame(void) {
+    return leds;
+}
+
+// Publica o back buffer como novo front de forma atômica; o novo back recebe uma cópia
+// dele para que efeitos incrementais continuem a partir do quadro publicado.
+void np_commit_frame(void) {
+    critical_section_enter_blocking(&np_lock);
+    np_front ^= 1;
+    leds = np_buffers[np_front ^ 1];
+    memcpy(leds, np_buffers[np_front], sizeof(np_buffers[0]));
+    np_quadro_pendente = true;
+    critical_section_exit(&np_lock);
+}
+
+static void np_iniciar_dma(void) {
+    np_empacotar_quadro();
+    np_quadro_concluido = false;
+    np_dma_ocupado = true;
+    dma_channel_transfer_from_buffer_now(np_dma_chan, np_quadro, LED_COUNT);
+}
+
+// Transmite por DMA o último quadro publicado, se houver um novo e o anterior já terminou.
+// Pensada para o núcleo que só transmite enquanto o outro compõe com begin/commit.
+bool np_present_frame(void) {
+    if (!np_quadro_pendente || npQuadroEmAndamento()) return false;
+    np_iniciar_dma();
+    return true;
+}
+
+// Verdadeiro enquanto o DMA estiver ativo ou o PIO ainda não tiver travado o quadro anterior.
+bool npQuadroEmAndamento(void) {
+    if (np_dma_ocupado) return true;
+    return (time_us_64() - np_fim_envio_us) < NP_TEMPO_LATCH_US;
+}
+
+void npAguardarQuadro(void) {
+    while (npQuadroEmAndamento()) {
+        tight_loop_contents();
+    }
+}
+
+void npSetCallbackQuadro(npCallbackQuadro_t cb) {
+    np_callback = cb;
+}
+
+// Brilho global (0 a 255) aplicado a todos os quadros enviados.
+void npSetBrilho(uint8_t brilho) {
+    critical_section_enter_blocking(&np_lock);
+    np_brilho = brilho;
+    np_atualizar_lut();
+    critical_section_exit(&np_lock);
+}
+
+// Liga/desliga a correção de gama no empacotamento.
+void npSetGamma(bool ativo) {
+    critical_section_enter_blocking(&np_lock);
+    np_gamma_ativo = ativo;
+    np_atualizar_lut();
+    critical_section_exit(&np_lock);
+}
+
+// Publica o buffer e dispara o DMA sem bloquear. Retorna false se ainda há quadro em
+// andamento; o quadro fica publicado e pode ser enviado depois por np_present_frame().
+bool npWriteAsync(void) {
+    np_commit_frame();
+    if (npQuadroEmAndamento()) return false;
+    np_iniciar_dma();
+    return true;
+}
+
 void npWrite(void) {
+    np_commit_frame();
+    npAguardarQuadro();
+    np_empacotar_quadro();
     for (uint i = 0; i < LED_COUNT; ++i) {
-        pio_sm_put_blocking(np_pio, sm, leds[i].G);
-        pio_sm_put_blocking(np_pio, sm, leds[i].R);
-        pio_sm_put_blocking(np_pio, sm, leds[i].B);
+        pio_sm_put_blocking(np_pio, sm, np_quadro[i]);
     }
+    np_fim_envio_us = time_us_64();
 }
 
 void npWriteComBrilho(float brilho) {
+    // Única conversão em ponto flutuante do quadro: o fator vira Q8 (0 a 256).
+    uint32_t escala = brilho <= 0.f ? 0 : brilho >= 1.f ? 256 : (uint32_t)(brilho * 256.f);
+
+    np_commit_frame();
+    npAguardarQuadro();
+    critical_section_enter_blocking(&np_lock);
+    const npLED_t *front = np_buffers[np_front];
     for (uint i = 0; i < LED_COUNT; ++i) {
-        uint8_t r = leds[i].R * brilho;
-        uint8_t g = leds[i].G * brilho;
-        uint8_t b = leds[i].B * brilho;
-        pio_sm_put_blocking(np_pio, sm, g);
-        pio_sm_put_blocking(np_pio, sm, r);
-        pio_sm_put_blocking(np_pio, sm, b);
+        np_quadro[i] = np_empacotar_escala(&front[i], escala);
     }
+    np_quadro_pendente = false;
+    critical_section_exit(&np_lock);
+
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        pio_sm_put_blocking(np_pio, sm, np_quadro[i]);
+    }
+    np_fim_envio_us = time_us_64();
 }
 
-void npSetLED(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
+void npSetLED(uint16_t index, uint8_t r, uint8_t g, uint8_t b) {
     if (index < LED_COUNT) {
         leds[index].R = r;
         leds[index].G = g;
@@ -51,6 +299,22 @@ void npClear(void) {
     npSetAll(0, 0, 0);
 }
 
+// Cada linha lógica ocupa LEDs consecutivos na fita: preenche sem consultar o mapa.
+void npSetLinha(uint y, uint8_t r, uint8_t g, uint8_t b) {
+    if (y >= NUM_LINHAS) return;
+    npLED_t *linha = &leds[NP_LINHA_FISICA(y) * NUM_COLUNAS];
+    for (uint x = 0; x < NUM_COLUNAS; ++x) {
+        linha[x] = (npLED_t){ .G = g, .R = r, .B = b };
+    }
+}
+
+void npSetColuna(uint x, uint8_t r, uint8_t g, uint8_t b) {
+    if (x >= NUM_COLUNAS) return;
+    for (uint y = 0; y < NUM_LINHAS; ++y) {
+        leds[np_mapa[y][x]] = (npLED_t){ .G = g, .R = r, .B = b };
+    }
+}
+
 void liberar_maquina_pio(PIO pio, uint sm_id) {
     if (sm_id < 4) {
         pio_sm_set_enabled(pio, sm_id, false);
@@ -60,7 +324,5 @@ void liberar_maquina_pio(PIO pio, uint sm_id) {
 
 uint getLEDIndex(uint x, uint y) {
     if (x >= NUM_COLUNAS || y >= NUM_LINHAS) return 0;
-    uint linha_fisica = NUM_LINHAS - 1 - y;
-    uint base = linha_fisica * NUM_COLUNAS;
-    return (linha_fisica % 2 == 0) ? base + (NUM_COLUNAS - 1 - x) : base + x;
+    return np_mapa[y][x];
 }
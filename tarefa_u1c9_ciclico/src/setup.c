@@ -9,8 +9,9 @@
  *      
  *      - Inicialização do terminal USB (stdio)
  *      - Configuração do ADC e habilitação do sensor interno
- *      - Configuração do canal DMA para leitura da temperatura
- *      - Registro da interrupção do canal DMA 0
+ *      - Configuração dos canais DMA 0 e 1 para leitura contínua
+ *        da temperatura (ping-pong)
+ *      - Registro da interrupção dos canais DMA 0 e 1
  *      - Inicialização do display OLED (SSD1306)
  *
  *      A função principal `setup()` deve ser chamada uma única
@@ -19,8 +20,8 @@
  *      antes de iniciar o executor cíclico.
  *
  *  Relacionamento:
- *      - Define a configuração global `cfg_temp` para uso
- *        posterior na Tarefa 1 (tarefa1_temp.c)
+ *      - Define as configurações globais `cfg_temp` e `cfg_temp_b`
+ *        e inicia a captura contínua da Tarefa 1 (tarefa1_temp.c)
  *      - Define os símbolos globais `ssd[]` e `area` usados na
  *        Tarefa 2 (tarefa2_display.c)
  *      - Utiliza o handler de interrupção definido em
@@ -37,14 +38,17 @@
 #include "hardware/irq.h"
 #include "inc/setup.h"
 #include "inc/irq_handlers.h"
-#include "inc/ssd1306.h"
-#include "inc/ssd1306_i2c.h"
+#include "ssd1306.h"
+#include "ssd1306_i2c.h"
 #include "hardware/i2c.h"
 #include "pico/binary_info.h"
 #include "inc/neopixel_driver.h"
+#include "inc/tarefas/tarefa1_temp.h"
 
 // === Buffer de vídeo do OLED (tela de 128 x 64) ===
-uint8_t ssd[ssd1306_buffer_length];
+// O byte de controle fica reservado antes dos pixels: o quadro vai ao I2C sem cópia.
+static ssd1306_framebuffer_t quadro_ssd = SSD1306_FRAMEBUFFER_INIT;
+uint8_t *const ssd = quadro_ssd.pixels;
 
 // === Área de renderização usada por render_on_display() ===
 struct render_area area = {
@@ -54,14 +58,26 @@ struct render_area area = {
     .end_page = ssd1306_n_pages - 1
 };
 
-// === Configuração global do canal DMA 0 ===
+// === Configuração global dos canais DMA 0 e 1 ===
 dma_channel_config cfg_temp;
+dma_channel_config cfg_temp_b;
+
+// Configuração comum aos dois canais da captura: ADC FIFO → buffer, 16 bits.
+static dma_channel_config config_canal_temp(int canal) {
+    dma_channel_claim(canal);   // Reserva o canal (o NeoPixel usa um canal livre)
+    dma_channel_config cfg = dma_channel_get_default_config(canal);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);  // 16 bits
+    channel_config_set_read_increment(&cfg, false);            // ADC FIFO fixo
+    channel_config_set_write_increment(&cfg, true);            // Buffer se move
+    channel_config_set_dreq(&cfg, DREQ_ADC);                   // dispara com ADC
+    return cfg;
+}
 
 /**
  * @brief Realiza a configuração inicial do sistema.
  *
  * Esta função inicializa o terminal USB, ADC, sensor de temperatura,
- * canal DMA 0, interrupções e o display OLED.
+ * canais DMA 0 e 1, interrupções, a captura contínua e o display OLED.
  */
 void setup() {
     // Inicializa a comunicação USB para printf()
@@ -72,18 +88,19 @@ void setup() {
     adc_init();
     adc_set_temp_sensor_enabled(true);
 
-    // Configura o canal DMA 0 para transferir dados do ADC
-    cfg_temp = dma_channel_get_default_config(DMA_TEMP_CHANNEL);
-    channel_config_set_transfer_data_size(&cfg_temp, DMA_SIZE_16);  // 16 bits
-    channel_config_set_read_increment(&cfg_temp, false);            // ADC FIFO fixo
-    channel_config_set_write_increment(&cfg_temp, true);            // Buffer se move
-    channel_config_set_dreq(&cfg_temp, DREQ_ADC);                   // dispara com ADC
+    // Configura os canais DMA 0 e 1 para transferir dados do ADC
+    cfg_temp = config_canal_temp(DMA_TEMP_CHANNEL);
+    cfg_temp_b = config_canal_temp(DMA_TEMP_CHANNEL_B);
 
-    // Configura interrupção do canal DMA 0
+    // Configura interrupção dos canais DMA 0 e 1
     dma_channel_set_irq0_enabled(DMA_TEMP_CHANNEL, true);
+    dma_channel_set_irq0_enabled(DMA_TEMP_CHANNEL_B, true);
     irq_set_exclusive_handler(DMA_IRQ_0, dma_handler_temp);
     irq_set_enabled(DMA_IRQ_0, true);
 
+    // ADC em modo livre alimentando os dois canais, sem pausas entre blocos
+    tarefa1_iniciar_captura(&cfg_temp, DMA_TEMP_CHANNEL, &cfg_temp_b, DMA_TEMP_CHANNEL_B);
+
     // Inicializa o display OLED SSD1306 via I2C
     i2c_init(i2c1, 400 * 1000);  // <---I2C primeiro
     gpio_set_function(14, GPIO_FUNC_I2C);
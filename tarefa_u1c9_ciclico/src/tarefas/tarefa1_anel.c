@@ -0,0 +1,67 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: tarefa1_anel.c
+ *  Projeto: TempCycleDMA
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Consumo das metades do buffer ping-pong da Tarefa 1.
+ *      Uma metade só pode ser lida enquanto a outra enche; o
+ *      contador de concluídas diz quais estão prontas e, lido
+ *      de novo depois da filtragem, se a metade foi reescrita
+ *      no meio dela.
+ *
+ *  Relacionamento:
+ *      - Usado por 'tarefa1_temp.c' com o contador do handler
+ *        de 'irq_handlers.c'.
+ *      - Compila sem o Pico SDK (testes/teste_anel_temp.c).
+ *
+ *  
+ *  Data: 11/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include "inc/tarefas/tarefa1_anel.h"
+
+void tarefa1_anel_iniciar(tarefa1_anel_t *anel, const uint16_t *metade_0, const uint16_t *metade_1,
+                          uint32_t bloco_amostras, const volatile uint32_t *concluidas,
+                          uint8_t log2_decimacao) {
+    anel->metades[0] = metade_0;
+    anel->metades[1] = metade_1;
+    anel->bloco_amostras = bloco_amostras;
+    anel->concluidas = concluidas;
+    anel->proxima = *concluidas;           // Metade em preenchimento agora
+    anel->blocos_filtrados = 0;
+    anel->amostras_perdidas = 0;
+    adc_decimador_iniciar(&anel->decimador, 1, log2_decimacao);
+}
+
+bool tarefa1_anel_consumir(tarefa1_anel_t *anel, int32_t *codigo) {
+    bool saiu = false;
+
+    while (*anel->concluidas != anel->proxima) {
+        uint32_t prontas = *anel->concluidas - anel->proxima;
+        if (prontas > 1) {
+            anel->amostras_perdidas += (prontas - 1) * anel->bloco_amostras;
+            anel->proxima += prontas - 1;      // Só a mais recente está intacta
+            adc_decimador_zerar(&anel->decimador);
+        }
+
+        int32_t saida;
+        uint32_t saidas = adc_decimador_bloco(&anel->decimador, anel->metades[anel->proxima % 2],
+                                              anel->bloco_amostras, &saida, 1);
+
+        // Se a outra metade terminou durante a filtragem, esta voltou a ser escrita
+        if (*anel->concluidas - anel->proxima > 1) {
+            anel->amostras_perdidas += anel->bloco_amostras;
+            adc_decimador_zerar(&anel->decimador);
+        } else {
+            anel->blocos_filtrados++;
+            if (saidas > 0) {
+                *codigo = saida;
+                saiu = true;
+            }
+        }
+        anel->proxima++;
+    }
+    return saiu;
+}
@@ -7,24 +7,35 @@
  *      Este módulo implementa a Tarefa 1 do executor cíclico,
  *      responsável por realizar a leitura do sensor interno
  *      de temperatura utilizando ADC + DMA, durante um intervalo
- *      contínuo de 0,5 segundos.
+ *      contínuo de 2^18 amostras (0,524 segundos).
  *
- *      A leitura é feita em blocos menores (10.000 amostras)
- *      para evitar o uso excessivo da SRAM do RP2040. Cada
- *      bloco é transferido via DMA e processado de forma
- *      incremental para obter a média da temperatura ao final
- *      do intervalo total.
+ *      O ADC roda em modo livre desde o setup. Dois canais DMA
+ *      encadeados se alternam (ping-pong) nas duas metades do
+ *      buffer (4.096 amostras cada), e o endereço de escrita de
+ *      cada canal dá a volta na sua metade (anel): nenhum bloco
+ *      é reconfigurado e não há pausas entre eles. A CPU filtra
+ *      uma metade enquanto a outra é preenchida; metades
+ *      reescritas antes de filtradas são contadas como perdas
+ *      (tarefa1_anel.c).
+ *
+ *      A tarefa não espera o DMA: cada chamada do laço principal
+ *      filtra as metades que ficaram prontas (uma a cada 8 ms)
+ *      e avisa quando sai uma média nova.
  *
  *  Funcionalidades:
- *      - Converte valores brutos do ADC para graus Celsius.
- *      - Controla o tempo de aquisição com precisão usando
- *        o clock interno via 'get_absolute_time()'.
- *      - Utiliza DMA canal 0 e depende da flag 'dma_temp_done'
- *        sinalizada pelo handler definido em 'irq_handlers.c'.
+ *      - Filtra e decima as amostras de 500 kS/s com um CIC de
+ *        ordem 1 (boxcar) de R = 2^18: uma saída a cada 0,524 s,
+ *        em ponto fixo com 9 bits além dos 12 do ADC.
+ *      - Converte a saída para milésimos de grau só com inteiros
+ *        (adc_temperatura_mc, bibliotecas/adc_amostrador).
+ *      - Utiliza os canais DMA 0 e 1 e depende do contador
+ *        'dma_temp_blocos' incrementado pelo handler definido
+ *        em 'irq_handlers.c'.
  *
  *  Relacionamento:
- *      - Chamado pelo laço principal em 'main.c' como tarefa do ciclo.
- *      - Requer configuração do canal DMA e IRQ em 'setup.c'.
+ *      - Chamado a cada volta do laço principal em 'main.c'.
+ *      - Requer configuração dos canais DMA e IRQ em 'setup.c',
+ *        que também chama 'tarefa1_iniciar_captura()'.
  *
  *  
  *  Data: 11/05/2025
@@ -34,75 +45,80 @@
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
 #include "hardware/dma.h"
-#include "hardware/sync.h"
+#include "inc/irq_handlers.h"
 #include "inc/tarefas/tarefa1_temp.h"
+#include "inc/tarefas/tarefa1_anel.h"
 
-#define BLOCO_AMOSTRAS 10000
-#define DURACAO_AMOSTRAGEM_US 500000  // 0,5 segundos em microssegundos
+#define BITS_ANEL 13                              // Metade de 2^13 bytes
+#define BLOCO_AMOSTRAS ((1u << BITS_ANEL) / 2)    // 4.096 amostras de 16 bits
+#define LOG2_DECIMACAO 18      // 2^18 amostras a 500 kS/s = 0,524 s por média
 
-static uint16_t buffer_temp[BLOCO_AMOSTRAS];
-extern volatile bool dma_temp_done;
+// O anel exige cada metade alinhada ao próprio tamanho
+static uint16_t buffer_temp[2][BLOCO_AMOSTRAS] __attribute__((aligned(1u << BITS_ANEL)));
 
-/**
- * @brief Converte valor do ADC para temperatura em °C.
- * 
- * @param raw Valor bruto de 12 bits lido do ADC.
- * @return float Temperatura em graus Celsius.
- */
-static float convert_to_celsius(uint16_t raw) {
-    const float conv = 3.3f / (1 << 12);  // Conversão para tensão
-    float voltage = raw * conv;
-    return 27.0f - (voltage - 0.706f) / 0.001721f;
-}
+static tarefa1_anel_t anel;
 
 /**
- * @brief Inicia uma transferência via DMA de um bloco do sensor de temperatura.
+ * @brief Inicia a captura contínua: ADC em modo livre e dois canais DMA.
+ *
+ * Cada canal escreve a sua metade do buffer e, ao terminar, dispara o
+ * outro (encadeamento). O endereço de escrita volta ao início da metade
+ * sozinho (anel) e a contagem de transferências é recarregada a cada
+ * disparo, então a captura segue sem intervenção da CPU.
  *
- * @param buffer Buffer de destino.
- * @param cfg Configuração do canal DMA.
- * @param dma_chan Canal DMA utilizado.
+ * @param cfg_a Configuração do canal que começa (metade 0).
+ * @param canal_a Número desse canal DMA.
+ * @param cfg_b Configuração do canal par (metade 1).
+ * @param canal_b Número desse canal DMA.
  */
-static void iniciar_dma_temp(uint16_t *buffer, dma_channel_config *cfg, int dma_chan) {
+void tarefa1_iniciar_captura(dma_channel_config *cfg_a, int canal_a,
+                             dma_channel_config *cfg_b, int canal_b) {
+    channel_config_set_ring(cfg_a, true, BITS_ANEL);
+    channel_config_set_ring(cfg_b, true, BITS_ANEL);
+    channel_config_set_chain_to(cfg_a, canal_b);
+    channel_config_set_chain_to(cfg_b, canal_a);
+
+    tarefa1_anel_iniciar(&anel, buffer_temp[0], buffer_temp[1], BLOCO_AMOSTRAS,
+                         &dma_temp_blocos, LOG2_DECIMACAO);
+
     adc_select_input(4);           // Canal 4 → sensor interno
-    adc_fifo_drain();
     adc_run(false);
     adc_fifo_setup(true, true, 1, false, false);
-    adc_run(true);
+    adc_fifo_drain();
 
-    dma_channel_configure(
-        dma_chan,
-        cfg,
-        buffer, &adc_hw->fifo,
-        BLOCO_AMOSTRAS,
-        true
-    );
+    dma_channel_configure(canal_b, cfg_b, buffer_temp[1], &adc_hw->fifo, BLOCO_AMOSTRAS, false);
+    dma_channel_configure(canal_a, cfg_a, buffer_temp[0], &adc_hw->fifo, BLOCO_AMOSTRAS, true);
+    adc_run(true);
 }
 
 /**
- * @brief Executa a Tarefa 1 do executor cíclico: coleta de temperatura por 0,5s.
+ * @brief Executa a Tarefa 1 do executor cíclico sem bloquear.
+ *
+ * Filtra as metades do buffer que ficaram prontas desde a última
+ * chamada; uma média sai a cada 64 metades. Deve ser chamada pelo
+ * menos uma vez a cada metade (8 ms), senão as metades atrasadas
+ * são reescritas e contadas como perdidas.
  *
- * @param cfg_temp Configuração do canal DMA.
- * @param dma_chan Número do canal DMA utilizado.
- * @return float Temperatura média calculada ao final do intervalo.
+ * @param media_mc Recebe a média nova, em milésimos de grau Celsius
+ * @return true se saiu uma média nesta chamada
  */
-float tarefa1_obter_media_temp(dma_channel_config* cfg_temp, int dma_chan) {
-    float soma = 0.0f;
-    uint32_t total_amostras = 0;
-
-    absolute_time_t inicio = get_absolute_time();
-
-    while (absolute_time_diff_us(inicio, get_absolute_time()) < DURACAO_AMOSTRAGEM_US) {
-        dma_temp_done = false;
-        iniciar_dma_temp(buffer_temp, cfg_temp, dma_chan);
-        while (!dma_temp_done) __wfi();  // Aguarda fim do DMA
-        adc_run(false); // Desliga o ADC
-
-        for (int i = 0; i < BLOCO_AMOSTRAS; i++) {
-            soma += convert_to_celsius(buffer_temp[i]);
-        }
+bool tarefa1_processar_temp(int32_t *media_mc) {
+    int32_t codigo;         // Média em Q12.9
+    if (!tarefa1_anel_consumir(&anel, &codigo)) return false;
 
-        total_amostras += BLOCO_AMOSTRAS;
-    }
+    *media_mc = adc_temperatura_mc(codigo, anel.decimador.bits_frac);
+    return true;
+}
 
-    return soma / total_amostras;
-}
\ No newline at end of file
+/**
+ * @brief Contadores de perda da captura, para diagnóstico.
+ *
+ * @return tarefa1_perdas_t Valores acumulados desde o início.
+ */
+tarefa1_perdas_t tarefa1_obter_perdas(void) {
+    return (tarefa1_perdas_t){
+        .blocos_filtrados = anel.blocos_filtrados,
+        .amostras_perdidas = anel.amostras_perdidas,
+        .estouros_fifo = adc_estouros_fifo,
+    };
+}
@@ -4,12 +4,14 @@
  *  Projeto: TempCycleDMA
  * ------------------------------------------------------------
  *  Descrição:
- *      Tarefa 2 corrigida: exibe no display OLED duas linhas:
+ *      Tarefa 2 corrigida: exibe no display OLED o título, um
+ *      gráfico de varredura das leituras da Tarefa 1, a média
+ *      em fonte grande e a tendência:
  *
- *         TEMP: 32.4 C
- *         TEND: ESTAVEL
- *
- *      Ambas centralizadas horizontalmente, usando fonte padrão.
+ *            Temp. Media
+ *         (gráfico, 24 px)
+ *         32.4 C
+ *         ESTAVEL +0.04C/m   (tendência e °C/min)
  *
  *  
  *  Data: 12/05/2025
@@ -18,41 +20,66 @@
 
 #include <stdio.h>
 #include <string.h>
-#include "inc/ssd1306.h"
+#include "ssd1306.h"
 #include "inc/display_utils.h"
 #include "inc/tarefas/tarefa2_display.h"
 #include "inc/tarefas/tarefa3_tendencia.h"
 
-extern uint8_t ssd[];
-extern struct render_area area;
+extern uint8_t *const ssd;
 
-void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia) {
-    ssd1306_clear_display(ssd);
-    render_on_display(ssd, &area);  // Garante que a limpeza seja visível
-    sleep_ms(20);                   // Pequeno delay opcional
+// Gráfico de varredura nas páginas 1 a 3, entre o título e o valor grande
+#define GRAFICO_PAGINA_INI 1
+#define GRAFICO_PAGINAS    3
+#define GRAFICO_MINIMO     20.0f     // °C no pé do gráfico
+#define GRAFICO_MAXIMO     44.0f     // °C no topo (1 °C por pixel)
 
-    char* linha1 = "Temperatura";
-    char* linha2 = "Media";
-    char linha3[30];
+static ssd1306_grafico_t grafico;
+
+// Na primeira vez apaga a tela, escreve o título fixo e posiciona o gráfico.
+static void preparar_tela(void) {
+    static bool tela_preparada = false;
+    if (tela_preparada) return;
 
-    snprintf(linha3, sizeof(linha3), "TEMP: %s", tendencia_para_texto(tendencia));
+    char* linha1 = "Temp. Media";
 
-    // Fonte padrão: 6 px por caractere, altura: 8 px
-    int x1 = (128 - strlen(linha1) * 6) / 2;
-    int x2 = (128 - strlen(linha2) * 6) / 2;
-    int x3 = (128 - strlen(linha3) * 6) / 2;
+    // Fonte padrão: 8 px por caractere (16 cabem nos 128 px), altura: 8 px
+    int x1 = (128 - (int)strlen(linha1) * 8) / 2;
 
-    // Y = linha × altura da fonte (8 px padrão)
+    ssd1306_clear_display(ssd);
     ssd1306_draw_string(ssd, x1, 0, linha1);    // Linha 0 (Y=0)
-    // Linha 1 = em branco (Y=8)
-    ssd1306_draw_string(ssd, x2, 16, linha2);   // Linha 2 (Y=16)
-    // Linha 3 = em branco (Y=24)
+    ssd1306_grafico_iniciar(&grafico, ssd1306_padrao_quadro(ssd), 0, 128,
+                            GRAFICO_PAGINA_INI, GRAFICO_PAGINAS, GRAFICO_MINIMO, GRAFICO_MAXIMO);
+    tela_preparada = true;
+}
 
-    // Fonte grande começa abaixo: Y=32 px
+void tarefa2_registrar_amostra(float temperatura) {
+    preparar_tela();
+
+    // Cada leitura envia só duas colunas do gráfico
+    ssd1306_grafico_adicionar(&grafico, temperatura);
+}
+
+void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia) {
+    static char linha3_exibida[30] = "";
+
+    char linha3[30];
+
+    // Tendência e inclinação em °C/min (16 colunas de texto)
+    snprintf(linha3, sizeof(linha3), "%s%+6.2fC/m", tendencia_para_texto(tendencia),
+             tarefa3_inclinacao_c_min());
+
+    // Depois da preparação só o que mudou é redesenhado e enviado.
+    preparar_tela();
+
+    // Fonte grande começa abaixo: Y=32 px (só os dígitos alterados)
     mostrar_valor_grande(ssd, temperatura, 32);
 
-    ssd1306_draw_string(ssd, 0, 56, linha3);  // Y = 32 
+    if (strcmp(linha3, linha3_exibida) != 0) {
+        ssd1306_dev_limpar_paginas(ssd1306_padrao_quadro(ssd), 7, 7);
+        ssd1306_draw_string(ssd, 0, 56, linha3);  // Y = 56 (última página)
+        snprintf(linha3_exibida, sizeof(linha3_exibida), "%s", linha3);
+    }
 
-    render_on_display(ssd, &area);
+    // Envia só os retângulos alterados
+    ssd1306_flush(ssd);
 }
-
@@ -18,12 +18,12 @@
 
 #include <stdio.h>
 #include <string.h>
-#include "inc/ssd1306.h"
+#include "ssd1306.h"
 #include "inc/display_utils.h"
 #include "inc/tarefas/tarefa2_display.h"
 #include "inc/tarefas/tarefa3_tendencia.h"
 
-extern uint8_t ssd[];
+extern uint8_t *const ssd;
 extern struct render_area area;
 
 void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia) {
@@ -7,19 +7,23 @@
  *      Este módulo implementa a Tarefa 3 do executor cíclico:
  *      a análise de tendência da temperatura.
  *      
- *      A função compara a temperatura atual com a anterior
- *      e classifica como:
+ *      Cada média da Tarefa 1 entra numa regressão linear
+ *      móvel (as últimas 25 médias, 30 s) e a inclinação da reta
+ *      classifica a temperatura como:
  *          - TENDÊNCIA_SUBINDO
  *          - TENDÊNCIA_CAINDO
  *          - TENDÊNCIA_ESTÁVEL
  *
- *      A tendência é detectada com base em um limiar mínimo
- *      de variação (±0.05°C) e pode ser exibida no terminal
- *      ou no display OLED.
- * 
+ *      A comparação de duas leituras seguidas oscilava com o
+ *      ruído; a reta sobre a janela o filtra, e a histerese
+ *      (entra em ±0,30 °C/min, volta abaixo de ±0,15 °C/min)
+ *      evita trocas na fronteira.
+ *
  *  Funcionalidades:
- *      - Armazena a última temperatura registrada
+ *      - Mantém Σy e Σxy da janela em inteiros: cada amostra
+ *        custa O(1), sem alocação
  *      - Retorna enum `tendencia_t` representando o estado
+ *      - Expõe a inclinação em °C/min
  *      - Oferece função auxiliar para converter enum em string
  *
  *  Relacionamento:
@@ -33,28 +37,98 @@
 
 #include "inc/tarefas/tarefa3_tendencia.h"
 
-static float temperatura_anterior = 0.0f;
+#define JANELA_TAREFA3 25              // 30 s de médias
+#define LIMIAR_ENTRADA_C_MIN 0.30f
+#define LIMIAR_SAIDA_C_MIN 0.15f
+
+static tendencia_motor_t motor;
 static int primeiro_ciclo = 1;
 
-tendencia_t tarefa3_analisa_tendencia(float atual) {
-    tendencia_t resultado;
+void tendencia_motor_iniciar(tendencia_motor_t *motor, uint8_t janela, uint32_t periodo_ms,
+                             float limiar_entrada, float limiar_saida) {
+    if (janela < 2) janela = 2;
+    if (janela > TENDENCIA_JANELA_MAX) janela = TENDENCIA_JANELA_MAX;
 
-    if (primeiro_ciclo) {
-        resultado = TENDENCIA_ESTÁVEL;
-        primeiro_ciclo = 0;
+    motor->janela = janela;
+    motor->quantidade = 0;
+    motor->inicio = 0;
+    motor->soma_y = 0;
+    motor->soma_xy = 0;
+    motor->escala = 60.0f / (float)periodo_ms;     // m°C/amostra → °C/min
+    motor->limiar_entrada = limiar_entrada;
+    motor->limiar_saida = limiar_saida;
+    motor->inclinacao = 0.0f;
+    motor->estado = TENDENCIA_ESTÁVEL;
+}
+
+// Inclinação por mínimos quadrados com x = 0..n-1:
+// (n·Σxy - Σx·Σy) / (n·Σx² - (Σx)²), e o denominador vale n²(n²-1)/12.
+static float inclinacao_c_min(const tendencia_motor_t *motor) {
+    int64_t n = motor->quantidade;
+    int64_t numerador = n * motor->soma_xy - (n * (n - 1) / 2) * motor->soma_y;
+    int64_t denominador = n * n * (n * n - 1) / 12;
+    return (float)numerador / (float)denominador * motor->escala;
+}
+
+// Histerese: sair de ESTÁVEL exige o limiar de entrada; voltar, ficar abaixo do de saída.
+static tendencia_t classificar(const tendencia_motor_t *motor) {
+    float i = motor->inclinacao;
+
+    switch (motor->estado) {
+        case TENDENCIA_SUBINDO:
+            if (i >= motor->limiar_saida) return TENDENCIA_SUBINDO;
+            break;
+        case TENDENCIA_CAINDO:
+            if (i <= -motor->limiar_saida) return TENDENCIA_CAINDO;
+            break;
+        default:
+            break;
+    }
+
+    if (i > motor->limiar_entrada) return TENDENCIA_SUBINDO;
+    if (i < -motor->limiar_entrada) return TENDENCIA_CAINDO;
+    return TENDENCIA_ESTÁVEL;
+}
+
+tendencia_t tendencia_motor_adicionar(tendencia_motor_t *motor, int32_t mili_celsius) {
+    if (motor->quantidade < motor->janela) {
+        // Enchendo: a nova amostra recebe x = quantidade
+        motor->amostras[motor->quantidade] = mili_celsius;
+        motor->soma_xy += (int64_t)motor->quantidade * mili_celsius;
+        motor->soma_y += mili_celsius;
+        motor->quantidade++;
     } else {
-        float delta = atual - temperatura_anterior;
+        // Cheia: a mais antiga sai e as demais descem um x (Σxy perde Σy restante)
+        int32_t antiga = motor->amostras[motor->inicio];
+        motor->soma_xy += -(motor->soma_y - antiga) + (int64_t)(motor->janela - 1) * mili_celsius;
+        motor->soma_y += mili_celsius - antiga;
+        motor->amostras[motor->inicio] = mili_celsius;
+        motor->inicio = (motor->inicio + 1) % motor->janela;
+    }
 
-        if (delta > 0.02f)
-            resultado = TENDENCIA_SUBINDO;
-        else if (delta < -0.02f)
-            resultado = TENDENCIA_CAINDO;
-        else
-            resultado = TENDENCIA_ESTÁVEL;
+    // Com menos de 2 pontos a reta não existe (denominador zero)
+    if (motor->quantidade < 2 || motor->quantidade * 2 < motor->janela) {
+        motor->inclinacao = 0.0f;
+        motor->estado = TENDENCIA_ESTÁVEL;
+    } else {
+        motor->inclinacao = inclinacao_c_min(motor);
+        motor->estado = classificar(motor);
     }
+    return motor->estado;
+}
+
+tendencia_t tarefa3_analisa_tendencia(int32_t mili_celsius) {
+    if (primeiro_ciclo) {
+        tendencia_motor_iniciar(&motor, JANELA_TAREFA3, TENDENCIA_PERIODO_MS,
+                                LIMIAR_ENTRADA_C_MIN, LIMIAR_SAIDA_C_MIN);
+        primeiro_ciclo = 0;
+    }
+
+    return tendencia_motor_adicionar(&motor, mili_celsius);
+}
 
-    temperatura_anterior = atual;
-    return resultado;
+float tarefa3_inclinacao_c_min(void) {
+    return motor.inclinacao;
 }
 
 const char* tendencia_para_texto(tendencia_t t) {
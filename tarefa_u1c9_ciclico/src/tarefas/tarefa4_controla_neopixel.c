@@ -13,6 +13,10 @@
  *         - Tendência ESTÁVEL → matriz toda VERDE
  *         - Tendência CAINDO  → matriz toda AZUL
  *
+ *      Subindo e caindo acendem com brilho proporcional à
+ *      inclinação (tarefa3_inclinacao_c_min), do mínimo até
+ *      COR_MAX a partir de 1 °C/min.
+ *
  *      As cores são aplicadas a todos os LEDs simultaneamente,
  *      utilizando a função npSetAll() do driver de NeoPixels.
  *
@@ -30,6 +34,17 @@
 #include "inc/tarefas/tarefa3_tendencia.h"
 #include "inc/testes_cores.h"  // contém COR_AZUL, COR_VERDE, COR_VERMELHO
 
+#define NIVEL_MINIMO (COR_MEIA / 2)
+#define INCLINACAO_MAXIMA_C_MIN 1.0f   // Brilho máximo
+
+// Brilho da cor pela intensidade da variação
+static uint8_t nivel_por_inclinacao(void) {
+    float i = tarefa3_inclinacao_c_min();
+    if (i < 0.0f) i = -i;
+    if (i > INCLINACAO_MAXIMA_C_MIN) i = INCLINACAO_MAXIMA_C_MIN;
+    return (uint8_t)(NIVEL_MINIMO + (COR_MAX - NIVEL_MINIMO) * i / INCLINACAO_MAXIMA_C_MIN);
+}
+
 /**
  * @brief Define a cor de todos os LEDs da matriz de acordo com a tendência.
  *
@@ -38,15 +53,15 @@
 void tarefa4_matriz_cor_por_tendencia(tendencia_t t) {
     switch (t) {
         case TENDENCIA_CAINDO:
-            npSetAll(COR_AZUL);     // Azul
+            npSetAll(COR_APAGA, COR_APAGA, nivel_por_inclinacao());  // Azul
             break;
         case TENDENCIA_ESTÁVEL:
             npSetAll(COR_VERDE);    // Verde
             break;
         case TENDENCIA_SUBINDO:
-            npSetAll(COR_VERMELHO); // Vermelho
+            npSetAll(nivel_por_inclinacao(), COR_APAGA, COR_APAGA);  // Vermelho
             break;
     }
 
-    npWrite();  // Atualiza fisicamente a matriz
+    npWriteAsync();  // Dispara o DMA e devolve o controle ao executor
 }
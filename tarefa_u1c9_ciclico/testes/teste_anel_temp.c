@@ -0,0 +1,137 @@
+/**
+ * teste_anel_temp.c
+ *
+ * Simula o ping-pong da Tarefa 1 no host: um produtor escreve metades de
+ * um fluxo de amostras conhecido nas duas metades do buffer e avança o
+ * contador de concluídas, como o handler do DMA; tarefa1_anel_consumir()
+ * roda com atrasos variados. Cada média que sai é conferida com a soma
+ * exata das 64 metades que deveriam formá-la, e os contadores de perda
+ * com as metades que o produtor reescreveu antes da leitura. O contador
+ * começa perto de 2^32 para passar pela volta.
+ *
+ * A reescrita no meio da filtragem (a outra metade termina enquanto esta
+ * é lida) exige concorrência de verdade e fica fora desta simulação.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "inc/tarefas/tarefa1_anel.h"
+
+#define BLOCO_AMOSTRAS 4096         // Como em tarefa1_temp.c
+#define LOG2_DECIMACAO 18
+#define METADES_POR_SAIDA ((1u << LOG2_DECIMACAO) / BLOCO_AMOSTRAS)
+#define INICIO_CONTADOR (UINT32_MAX - 100u)
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static uint16_t metades[2][BLOCO_AMOSTRAS];
+static volatile uint32_t concluidas;
+
+// Fluxo injetado: rampa lenta perto do código 870 com ruído de ±4 LSB,
+// determinístico pela posição (metade, amostra).
+static uint16_t amostra(uint32_t metade, uint32_t i) {
+    uint32_t x = metade * 2654435761u ^ i * 40503u;
+    x ^= x >> 15;
+    x *= 2246822519u;
+    x ^= x >> 13;
+    return (uint16_t)(866 + (metade / 97) % 16 + x % 9);
+}
+
+// O DMA termina a metade em preenchimento e segue para a outra.
+static void produzir(uint32_t quantidade) {
+    for (uint32_t k = 0; k < quantidade; k++) {
+        uint32_t metade = concluidas;
+        for (uint32_t i = 0; i < BLOCO_AMOSTRAS; i++) {
+            metades[metade % 2][i] = amostra(metade, i);
+        }
+        concluidas = metade + 1;
+    }
+}
+
+// Saída esperada depois de filtrar até 'proxima - 1': Q12.9 arredondado.
+static int32_t esperado(uint32_t proxima) {
+    uint64_t soma = 0;
+    for (uint32_t m = proxima - METADES_POR_SAIDA; m != proxima; m++) {
+        for (uint32_t i = 0; i < BLOCO_AMOSTRAS; i++) soma += amostra(m, i);
+    }
+    return (int32_t)((soma + (1u << 8)) >> 9);
+}
+
+typedef struct {
+    uint32_t saidas;
+    uint32_t perdidas_esperadas;    // Metades reescritas antes da leitura
+    uint32_t erradas;
+} cenario_t;
+
+static void consumir(tarefa1_anel_t *anel, cenario_t *c) {
+    // Da próxima a ler, só a última concluída ainda está no buffer
+    uint32_t prontas = concluidas - anel->proxima;
+    if (prontas > 1) c->perdidas_esperadas += prontas - 1;
+
+    int32_t codigo;
+    if (tarefa1_anel_consumir(anel, &codigo)) {
+        c->saidas++;
+        if (codigo != esperado(anel->proxima)) c->erradas++;
+    }
+    VERIFICAR(anel->proxima == concluidas, "consumo parou antes das metades prontas");
+}
+
+// Metades concluídas entre duas chamadas: às vezes nenhuma (laço ocioso),
+// quase sempre uma e, numa chamada em 'raridade', de 2 a 'atraso_max'
+// (a Tarefa 2 segurou o laço no I2C).
+static uint32_t avancar(uint32_t atraso_max, uint32_t raridade) {
+    if (atraso_max > 1 && rand() % raridade == 0) return 2 + (uint32_t)rand() % (atraso_max - 1);
+    return rand() % 4 == 0 ? 0 : 1;
+}
+
+static void simular(const char *nome, uint32_t metades_total, uint32_t atraso_max, uint32_t semente) {
+    tarefa1_anel_t anel;
+    cenario_t c = { 0 };
+    concluidas = INICIO_CONTADOR;
+    tarefa1_anel_iniciar(&anel, metades[0], metades[1], BLOCO_AMOSTRAS, &concluidas, LOG2_DECIMACAO);
+    srand(semente);
+
+    uint32_t produzidas = 0;
+    while (produzidas < metades_total) {
+        uint32_t k = avancar(atraso_max, 2 * METADES_POR_SAIDA);
+        produzir(k);
+        produzidas += k;
+        consumir(&anel, &c);
+    }
+
+    printf("%s: %u metades, %u filtradas, %u perdidas, %u médias\n", nome, produzidas,
+           anel.blocos_filtrados, anel.amostras_perdidas / BLOCO_AMOSTRAS, c.saidas);
+
+    VERIFICAR(c.erradas == 0, "%s: %u médias diferentes da soma exata", nome, c.erradas);
+    VERIFICAR(anel.amostras_perdidas == c.perdidas_esperadas * BLOCO_AMOSTRAS,
+              "%s: %u amostras perdidas contadas, %u esperadas", nome,
+              anel.amostras_perdidas, c.perdidas_esperadas * BLOCO_AMOSTRAS);
+    VERIFICAR(anel.blocos_filtrados + anel.amostras_perdidas / BLOCO_AMOSTRAS == produzidas,
+              "%s: metades sem destino", nome);
+    if (atraso_max <= 1) {
+        VERIFICAR(c.perdidas_esperadas == 0, "%s: perdas sem atraso", nome);
+        VERIFICAR(c.saidas == produzidas / METADES_POR_SAIDA, "%s: %u médias para %u metades",
+                  nome, c.saidas, produzidas);
+    } else {
+        VERIFICAR(c.perdidas_esperadas > 0 && c.saidas > 0,
+                  "%s: atraso sem perdas ou sem médias", nome);
+    }
+}
+
+int main(void) {
+    simular("em dia", 40 * METADES_POR_SAIDA, 1, 1);
+    simular("atraso de até 2 metades", 400 * METADES_POR_SAIDA, 2, 2);
+    simular("atraso de até 3 metades", 400 * METADES_POR_SAIDA, 3, 3);
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
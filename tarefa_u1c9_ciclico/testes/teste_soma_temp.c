@@ -0,0 +1,151 @@
+/**
+ * teste_soma_temp.c
+ *
+ * Exatidão e custo da média da Tarefa 1. O código antigo convertia cada
+ * amostra para °C e somava num float; hoje os códigos de 12 bits são somados
+ * em inteiros (adc_decimador_bloco, ordem 1, R = 2^18) e convertidos uma vez.
+ * Sobre janelas sintéticas perto de 28 °C, compara os dois caminhos com a
+ * soma exata em double e mede o custo por amostra.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "adc_decimador.h"
+
+#define LOG2_DECIMACAO 18           // Como em tarefa1_temp.c
+#define JANELA (1u << LOG2_DECIMACAO)
+#define BLOCO_AMOSTRAS 4096         // Metade do anel do DMA
+#define JANELAS 8
+#define REPETICOES_BANCADA 20
+
+// Limites: o inteiro só perde o arredondamento da conversão (< 2 m°C); o
+// float antigo, com 2^18 parcelas de ~28, já erra dezenas de m°C.
+#define TOLERANCIA_INTEIRO_MC 2.0
+#define DERIVA_MINIMA_FLOAT_MC 10.0
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static uint16_t amostras[JANELA];
+
+static double agora_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t semente = 12345;
+
+static uint32_t aleatorio(void) {
+    semente = semente * 1664525u + 1013904223u;
+    return semente >> 8;
+}
+
+// Sensor em ~28 °C (código ~874) com ruído triangular de ±4 LSB e um
+// deslocamento diferente por janela.
+static void gerar_janela(int janela) {
+    int base = 872 + janela % 5;
+    for (uint32_t i = 0; i < JANELA; i++) {
+        int ruido = (int)(aleatorio() % 5) + (int)(aleatorio() % 5) - 4;
+        amostras[i] = (uint16_t)(base + ruido);
+    }
+}
+
+// Caminho antigo de tarefa1_temp.c, sem mudanças.
+static float convert_to_celsius(uint16_t raw) {
+    const float conv = 3.3f / (1 << 12);  // Conversão para tensão
+    float voltage = raw * conv;
+    return 27.0f - (voltage - 0.706f) / 0.001721f;
+}
+
+static float media_float(void) {
+    float soma = 0.0f;
+    for (uint32_t i = 0; i < JANELA; i++) {
+        soma += convert_to_celsius(amostras[i]);
+    }
+    return soma / JANELA;
+}
+
+// Caminho atual: metades do anel no decimador, uma saída por janela.
+static int32_t media_inteira(adc_decimador_t *decimador) {
+    int32_t codigo = 0;
+    uint32_t saidas = 0;
+    for (uint32_t i = 0; i < JANELA; i += BLOCO_AMOSTRAS) {
+        saidas += adc_decimador_bloco(decimador, &amostras[i], BLOCO_AMOSTRAS, &codigo, 1);
+    }
+    VERIFICAR(saidas == 1, "%u saídas na janela", saidas);
+    return codigo;
+}
+
+static double celsius(double codigo) {
+    return 27.0 - (codigo * 3.3 / 4096.0 - 0.706) / 0.001721;
+}
+
+static void testar_exatidao(void) {
+    adc_decimador_t decimador;
+    adc_decimador_iniciar(&decimador, 1, LOG2_DECIMACAO);
+    double pior_float = 0, pior_inteiro = 0;
+
+    for (int j = 0; j < JANELAS; j++) {
+        gerar_janela(j);
+
+        uint64_t soma = 0;
+        for (uint32_t i = 0; i < JANELA; i++) soma += amostras[i];
+        double referencia = celsius((double)soma / JANELA);
+
+        int32_t codigo = media_inteira(&decimador);
+        int32_t esperado = (int32_t)((soma + (1u << (LOG2_DECIMACAO - decimador.bits_frac - 1)))
+                                     >> (LOG2_DECIMACAO - decimador.bits_frac));
+        VERIFICAR(codigo == esperado, "janela %d: código Q12.%u %d, soma exata dá %d",
+                  j, decimador.bits_frac, codigo, esperado);
+
+        double erro_inteiro = adc_temperatura_mc(codigo, decimador.bits_frac) - referencia * 1000.0;
+        double erro_float = (media_float() - referencia) * 1000.0;
+        if (fabs(erro_inteiro) > pior_inteiro) pior_inteiro = fabs(erro_inteiro);
+        if (fabs(erro_float) > pior_float) pior_float = fabs(erro_float);
+
+        printf("janela %d: %.4f °C  inteiro %+.2f m°C  float %+.2f m°C\n",
+               j, referencia, erro_inteiro, erro_float);
+    }
+
+    VERIFICAR(pior_inteiro <= TOLERANCIA_INTEIRO_MC, "caminho inteiro errou %.2f m°C", pior_inteiro);
+    VERIFICAR(pior_float >= DERIVA_MINIMA_FLOAT_MC,
+              "soma em float errou só %.2f m°C (a deriva esperada sumiu?)", pior_float);
+}
+
+static void medir_custo(void) {
+    adc_decimador_t decimador;
+    adc_decimador_iniciar(&decimador, 1, LOG2_DECIMACAO);
+    gerar_janela(0);
+    volatile float f = 0;
+    volatile int32_t c = 0;
+
+    double t0 = agora_ns();
+    for (int r = 0; r < REPETICOES_BANCADA; r++) f += media_float();
+    double t1 = agora_ns();
+    for (int r = 0; r < REPETICOES_BANCADA; r++) c += media_inteira(&decimador);
+    double t2 = agora_ns();
+
+    double n = (double)REPETICOES_BANCADA * JANELA;
+    printf("float: %.3f ns/amostra, inteiro: %.3f ns/amostra (%.1fx)\n",
+           (t1 - t0) / n, (t2 - t1) / n, (t1 - t0) / (t2 - t1));
+    (void)f;
+    (void)c;
+}
+
+int main(void) {
+    testar_exatidao();
+    medir_custo();
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * teste_tendencia.c
+ *
+ * Motor de tendência da Tarefa 3 sobre um traço sintético: 10 min estável em
+ * 30 °C, 10 min subindo 0,8 °C/min, 10 min estável, 10 min caindo 0,5 °C/min
+ * e estável até o fim, com ruído de 0,03 °C e uma média a cada 1,2 s. Confere
+ * que a tendência troca só nas quatro mudanças do traço (a comparação de duas
+ * médias seguidas, usada antes, troca a cada poucas), que a inclinação das
+ * somas móveis bate com a regressão refeita do zero e que janelas curtas
+ * (2 amostras) não produzem NaN.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "inc/tarefas/tarefa3_tendencia.h"
+
+#define MEDIAS 3000                 // 60 min de médias
+#define JANELA_TAREFA3 25           // Como em tarefa3_tendencia.c
+#define RUIDO_C 0.03
+#define ATRASO_MAX_MIN 1.0          // Da mudança do traço à troca de estado
+#define TOLERANCIA_C_MIN 1e-3
+
+static int falhas = 0;
+
+#define VERIFICAR(cond, ...) do {               \
+    if (!(cond)) {                              \
+        printf("FALHA: " __VA_ARGS__);          \
+        printf("\n");                           \
+        falhas++;                               \
+    }                                           \
+} while (0)
+
+static int32_t traco[MEDIAS];       // m°C
+
+static double minutos(int k) {
+    return k * (TENDENCIA_PERIODO_MS / 1000.0) / 60.0;
+}
+
+static double inclinacao_real(double t_min) {
+    if (t_min < 10) return 0.0;
+    if (t_min < 20) return 0.8;
+    if (t_min < 30) return 0.0;
+    if (t_min < 40) return -0.5;
+    return 0.0;
+}
+
+static double gaussiano(void) {
+    double u = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double v = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+static void gerar_traco(void) {
+    srand(7);
+    double t = 30.0;
+    for (int k = 0; k < MEDIAS; k++) {
+        t += inclinacao_real(minutos(k)) * (TENDENCIA_PERIODO_MS / 60000.0);
+        traco[k] = (int32_t)lround((t + RUIDO_C * gaussiano()) * 1000.0);
+    }
+}
+
+// Mínimos quadrados sobre traco[fim - n + 1 .. fim], em °C/min.
+static double regressao(int fim, int n) {
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (int i = 0; i < n; i++) {
+        double y = traco[fim - n + 1 + i];
+        sx += i;
+        sy += y;
+        sxx += (double)i * i;
+        sxy += i * y;
+    }
+    double b = (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    return b / 1000.0 * 60000.0 / TENDENCIA_PERIODO_MS;
+}
+
+// Estado esperado entre as mudanças do traço, na ordem.
+static const struct { double inicio_min; tendencia_t estado; } trocas_esperadas[] = {
+    { 10, TENDENCIA_SUBINDO },
+    { 20, TENDENCIA_ESTÁVEL },
+    { 30, TENDENCIA_CAINDO },
+    { 40, TENDENCIA_ESTÁVEL },
+};
+#define TROCAS_ESPERADAS (sizeof(trocas_esperadas) / sizeof(trocas_esperadas[0]))
+
+static void testar_traco(void) {
+    tendencia_t anterior = TENDENCIA_ESTÁVEL;
+    tendencia_t antigo_anterior = TENDENCIA_ESTÁVEL;
+    unsigned trocas = 0, trocas_antigo = 0;
+    double pior_erro = 0;
+
+    for (int k = 0; k < MEDIAS; k++) {
+        tendencia_t t = tarefa3_analisa_tendencia(traco[k]);
+        if (t != anterior) {
+            printf("%5.1f min: %s (%+.3f °C/min)\n", minutos(k), tendencia_para_texto(t),
+                   tarefa3_inclinacao_c_min());
+            if (trocas < TROCAS_ESPERADAS) {
+                double atraso = minutos(k) - trocas_esperadas[trocas].inicio_min;
+                VERIFICAR(t == trocas_esperadas[trocas].estado && atraso >= 0 && atraso <= ATRASO_MAX_MIN,
+                          "troca %u: %s em %.1f min", trocas + 1, tendencia_para_texto(t), minutos(k));
+            }
+            trocas++;
+        }
+        anterior = t;
+
+        // Critério antigo: diferença para a média anterior acima de 0,02 °C
+        int32_t d = k > 0 ? traco[k] - traco[k - 1] : 0;
+        tendencia_t antigo = d > 20 ? TENDENCIA_SUBINDO : d < -20 ? TENDENCIA_CAINDO : TENDENCIA_ESTÁVEL;
+        if (antigo != antigo_anterior) trocas_antigo++;
+        antigo_anterior = antigo;
+
+        if (k >= JANELA_TAREFA3 - 1) {
+            double erro = fabs(tarefa3_inclinacao_c_min() - regressao(k, JANELA_TAREFA3));
+            if (erro > pior_erro) pior_erro = erro;
+        }
+    }
+
+    printf("trocas: %u (comparando médias seguidas: %u), erro da inclinação %.1e °C/min\n",
+           trocas, trocas_antigo, pior_erro);
+    VERIFICAR(trocas == TROCAS_ESPERADAS, "%u trocas de estado", trocas);
+    VERIFICAR(pior_erro <= TOLERANCIA_C_MIN, "inclinação difere da regressão em %.1e °C/min", pior_erro);
+}
+
+// Da primeira amostra à janela cheia, em janelas de 2 a TENDENCIA_JANELA_MAX.
+static void testar_janelas(void) {
+    static const uint8_t janelas[] = { 2, 3, 5, TENDENCIA_JANELA_MAX };
+    for (unsigned j = 0; j < sizeof(janelas); j++) {
+        tendencia_motor_t motor;
+        tendencia_motor_iniciar(&motor, janelas[j], TENDENCIA_PERIODO_MS, 0.30f, 0.15f);
+
+        for (int k = 0; k < 3 * TENDENCIA_JANELA_MAX; k++) {
+            tendencia_motor_adicionar(&motor, traco[600 + k]);     // Trecho subindo
+            int n = k + 1 < janelas[j] ? k + 1 : janelas[j];
+
+            VERIFICAR(isfinite(motor.inclinacao), "janela %u, amostra %d: inclinação %f",
+                      janelas[j], k + 1, motor.inclinacao);
+            if (n >= 2 && n * 2 >= janelas[j]) {
+                double erro = fabs(motor.inclinacao - regressao(600 + k, n));
+                VERIFICAR(erro <= TOLERANCIA_C_MIN, "janela %u, amostra %d: erro %.1e °C/min",
+                          janelas[j], k + 1, erro);
+            } else {
+                VERIFICAR(motor.estado == TENDENCIA_ESTÁVEL && motor.inclinacao == 0.0f,
+                          "janela %u, amostra %d: tendência antes de haver reta", janelas[j], k + 1);
+            }
+        }
+    }
+}
+
+int main(void) {
+    gerar_traco();
+    testar_traco();
+    testar_janelas();
+
+    printf(falhas ? "%d falha(s)\n" : "ok\n", falhas);
+    return falhas ? 1 : 0;
+}
@@ -25,8 +25,8 @@
 #include "dhcpserver.h" // Para o servidor DHCP que atribui IPs aos clientes
 #include "dnsserver.h"  // Para o servidor DNS que resolve nomes para o IP do Pico
 
-// Include para o hardware ADC (Analog-to-Digital Converter)
-#include "hardware/adc.h" // Para ler o sensor de temperatura interno
+// Amostrador compartilhado do ADC (Analog-to-Digital Converter)
+#include "adc_amostrador.h" // Para ler o sensor de temperatura interno
 
 // === DEFINES GLOBAIS ===
 #define TCP_PORT 80         // Porta padrao para o servidor HTTP
@@ -147,12 +147,13 @@ typedef struct TCP_CONNECT_STATE_T_ {
 
 // === FUNCOES ===
 
-// Converte o valor bruto lido do ADC do sensor de temperatura para graus Celsius.
-float convert_to_celsius(uint16_t raw) {
-    const float conversion_factor = 3.3f / (1 << 12); // VRef / (2^resolucao_ADC)
-    float voltage = raw * conversion_factor;
-    // Formula do datasheet do RP2040: Temp (°C) = 27 - (ADC_voltage - 0.706) / 0.001721
-    return 27.0f - (voltage - 0.706f) / 0.001721f;
+// Ultima temperatura do sensor interno em graus Celsius. A media decimada chega
+// em ponto fixo (Q12.F) e a conversao pela formula do datasheet e inteira, em
+// milesimos de grau; o float so serve para formatar o texto.
+float ler_temperatura_celsius(void) {
+    int32_t codigo = adc_amostrador_ultimo_fino(ADC_CANAL_TEMPERATURA);
+    int32_t mili_celsius = adc_temperatura_mc(codigo, adc_amostrador_bits_frac(ADC_CANAL_TEMPERATURA));
+    return mili_celsius / 1000.0f;
 }
 
 // Fecha uma conexao TCP com um cliente de forma segura e libera recursos.
@@ -226,9 +227,7 @@ static void generate_server_response_content(TCP_CONNECT_STATE_T *con_state, con
             }
         }
         // Le a temperatura atual do sensor interno
-        adc_select_input(4); // Seleciona o canal ADC do sensor de temperatura
-        uint16_t raw_temp = adc_read(); // Le o valor bruto do ADC
-        float temp_c_atual = convert_to_celsius(raw_temp); // Converte para Celsius
+        float temp_c_atual = ler_temperatura_celsius(); // Ultimo valor do sensor, em Celsius
 
         // Formata o corpo HTML usando a macro MAIN_PAGE_HTML e os dados atuais
         con_state->body_len = snprintf(con_state->response_body, sizeof(con_state->response_body),
@@ -247,9 +246,7 @@ static void generate_server_response_content(TCP_CONNECT_STATE_T *con_state, con
         }
 
     } else if (strcmp(request_path, PATH_API_TEMPERATURE) == 0) { // Requisicao para o endpoint da API de temperatura
-        adc_select_input(4);
-        uint16_t raw_temp = adc_read();
-        float temp_c = convert_to_celsius(raw_temp);
+        float temp_c = ler_temperatura_celsius();
         // Formata o corpo da resposta como JSON
         con_state->body_len = snprintf(con_state->response_body, sizeof(con_state->response_body),
                                        "{\"temperatura\": %.2f}", temp_c);
@@ -480,9 +477,16 @@ int main() {
     gpio_set_dir(LED_GPIO, GPIO_OUT); // Define o pino como saida
     gpio_put(LED_GPIO, 0);            // Comeca com o LED desligado
 
-    // Inicializa o ADC para o sensor de temperatura interno
-    adc_init();
-    adc_set_temp_sensor_enabled(true); // Habilita o sensor de temperatura (usa canal ADC 4)
+    // Inicia o amostrador do ADC no sensor de temperatura interno (canal ADC 4):
+    // 16384 conversoes/s, decimadas por 2^12 (4 amostras/s com 6 bits alem dos
+    // 12 do ADC). Os callbacks do servidor leem o ultimo valor sem disputar o
+    // ADC com o laco principal. Espera a primeira media (250 ms): antes dela o
+    // ultimo valor e 0, que a formula converte em ~437 C
+    static const adc_decimacao_t decimacao[ADC_AMOSTRADOR_CANAIS] = {
+        [ADC_CANAL_TEMPERATURA] = { .ordem = 1, .log2_fator = 12 },
+    };
+    adc_amostrador_iniciar(ADC_MASCARA(ADC_CANAL_TEMPERATURA), 16384, decimacao);
+    while (!adc_amostrador_tem_amostra(ADC_CANAL_TEMPERATURA)) sleep_ms(10);
 
     // Aloca memoria para o estado do servidor TCP
     TCP_SERVER_T *server_state = calloc(1, sizeof(TCP_SERVER_T));
@@ -560,9 +564,7 @@ int main() {
     // Loop principal do programa
     while(!server_state->complete) {
         // Le e imprime a temperatura no terminal USB a cada segundo
-        adc_select_input(4); 
-        uint16_t raw_temp = adc_read();
-        float temp_c = convert_to_celsius(raw_temp);
+        float temp_c = ler_temperatura_celsius();
         printf("Temperatura interna atual (Terminal): %.2f C\n", temp_c); 
         
         sleep_ms(1000); // Pausa de 1 segundo
@@ -2,8 +2,9 @@
  * @file oled_utils.c
  * @brief Funções utilitárias para configuração e manipulação básica de displays OLED com controlador SSD1306 via I²C.
  *
- * Este módulo fornece duas funções essenciais para iniciar a comunicação com o display OLED 
- * e apagar seu conteúdo, sendo projetado para sistemas embarcados como o Raspberry Pi Pico.
+ * Este módulo fornece a função que inicia a comunicação com o display OLED e apaga seu
+ * conteúdo, sendo projetado para sistemas embarcados como o Raspberry Pi Pico.
+ * O driver em si (incluindo oled_clear()) vem da biblioteca bibliotecas/ssd1306.
  *
  * Funcionalidades implementadas:
  * - Inicialização do barramento I²C e do display OLED.
@@ -21,7 +22,6 @@
 #include "oled_utils.h"
 #include "hardware/i2c.h"
 #include "ssd1306.h"
-#include <string.h>  // Para uso da função memset()
 #include "ssd1306_i2c.h"
 
 /**
@@ -48,8 +48,8 @@ void setup_oled(uint8_t *ssd, struct render_area *area, i2c_inst_t *i2c_port, ui
     gpio_pull_up(sda);
     gpio_pull_up(scl);
 
-    // Inicializa o display OLED (sequência de comandos padrão SSD1306)
-    ssd1306_init();
+    // Inicializa o display OLED (sequência de comandos padrão SSD1306) na porta recebida
+    ssd1306_init_i2c(i2c_port, ssd1306_i2c_address);
 
     // Define os limites da área de renderização (tela inteira)
     area->start_column = 0;
@@ -63,22 +63,6 @@ void setup_oled(uint8_t *ssd, struct render_area *area, i2c_inst_t *i2c_port, ui
     // Se solicitado, limpa completamente a tela após a inicialização
     if (clear_display) {
         oled_clear(ssd, area);
+        render_on_display(ssd, area);
     }
 }
-
-/**
- * @brief Limpa o conteúdo gráfico do display (zera o buffer e atualiza a tela).
- *
- * @param ssd   Ponteiro para o buffer gráfico.
- * @param area  Estrutura com as coordenadas da área a ser renderizada (normalmente toda a tela).
- *
- * Esta função preenche o buffer com zeros (apagando visualmente a tela) e o envia ao display.
- */
-void oled_clear(uint8_t *ssd, struct render_area *area)
-{
-    // Preenche o buffer com zeros (todos os pixels apagados)
-    memset(ssd, 0, ssd1306_buffer_length);
-
-    // Envia o buffer atualizado para o display
-    render_on_display(ssd, area);
-}
@@ -9,7 +9,7 @@
  *
  * - `setup_oled(...)`: inicializa o display OLED com parâmetros específicos de pinos, frequência do barramento I²C,
  *    instância do periférico e controle da limpeza inicial da tela.
- * - `oled_clear(...)`: limpa o conteúdo visível do display, utilizando a área de renderização fornecida.
+ * - `oled_clear(...)` (do driver SSD1306): limpa o buffer; a tela muda no próximo `render_on_display()`.
  *
  * Dependências:
  * - `hardware/i2c.h`: biblioteca do SDK do Raspberry Pi Pico para comunicação I²C.
@@ -27,6 +27,5 @@
 #include <stdbool.h>
 
 void setup_oled(uint8_t *ssd, struct render_area *area, i2c_inst_t *i2c_port, uint sda, uint scl, uint freq_khz, bool clear_display);
-void oled_clear(uint8_t *ssd, struct render_area *area);
 
 #endif
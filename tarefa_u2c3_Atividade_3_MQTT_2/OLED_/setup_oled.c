@@ -21,6 +21,7 @@
 #include "ssd1306.h"           // ← necessário para ssd1306_init e calculate_render_area_buffer_length
 #include "oled_utils.h"        // ← necessário para oled_clear
 #include "setup_oled.h"  
+#include "estado_mqtt.h"       // ← tela retida e seus elementos
 
 /**
  * @brief Função principal de configuração do sistema.
@@ -59,5 +60,13 @@ void setup_init_oled(void) {
 
     // Limpa completamente o display
     oled_clear(buffer_oled, &area);
+    render_on_display(buffer_oled, &area);
+
+    // Tela retida: uma caixa por informação, redesenhada só quando muda
+    ssd1306_cena_iniciar(&tela_oled, ssd1306_padrao_quadro(buffer_oled));
+    oled_ip    = ssd1306_cena_texto(&tela_oled, 0, 0,  ssd1306_width, 8,  "");
+    oled_mqtt  = ssd1306_cena_texto(&tela_oled, 0, 16, ssd1306_width, 16, "");
+    oled_ping  = ssd1306_cena_texto(&tela_oled, 0, 32, ssd1306_width, 16, "");
+    oled_aviso = ssd1306_cena_texto(&tela_oled, 0, 48, ssd1306_width, 16, "");
 
 }
@@ -36,7 +36,7 @@
 
 
 // Buffers globais para OLED
-extern uint8_t buffer_oled[];
+extern uint8_t *const buffer_oled;
 extern struct render_area area;
 
 void setup_init_oled(void);
@@ -10,7 +10,8 @@
  * - O último endereço IP recebido (`ultimo_ip_bin`), utilizado para iniciar o cliente MQTT;
  * - Um flag (`mqtt_iniciado`) que garante que o cliente MQTT só será iniciado uma vez;
  * - Um buffer de vídeo (`buffer_oled`) para escrita no display OLED;
- * - A estrutura `area`, que define a região da tela sendo desenhada.
+ * - A estrutura `area`, que define a região da tela sendo desenhada;
+ * - A tela retida do OLED (`tela_oled`) e os seus elementos.
  *
  * O objetivo é **centralizar informações compartilhadas** entre os diversos arquivos
  * do projeto, evitando duplicação e facilitando a manutenção e legibilidade do código.
@@ -44,9 +45,11 @@ bool mqtt_iniciado = false;
  *
  * Este buffer contém os dados de pixels que serão renderizados na tela.
  * Seu tamanho é definido pela função `ssd1306_buffer_length`, de acordo com
- * a resolução do display (tipicamente 128x64).
+ * a resolução do display (tipicamente 128x64). O byte de controle fica reservado
+ * antes dos pixels (`ssd1306_framebuffer_t`), então o quadro vai ao I2C sem cópia.
  */
-uint8_t buffer_oled[ssd1306_buffer_length];
+static ssd1306_framebuffer_t quadro_oled = SSD1306_FRAMEBUFFER_INIT;
+uint8_t *const buffer_oled = quadro_oled.pixels;
 
 /**
  * @brief Estrutura que define a área da tela a ser desenhada.
@@ -55,3 +58,16 @@ uint8_t buffer_oled[ssd1306_buffer_length];
  * como `render_on_display()`.
  */
 struct render_area area;
+
+/**
+ * @brief Tela retida do OLED e os seus elementos.
+ *
+ * Os elementos são criados em `setup_init_oled()`. Trocar um texto só marca o
+ * elemento; `ssd1306_cena_processar()`, no laço principal, redesenha as caixas
+ * alteradas e vence os avisos temporários, sem `sleep_ms()`.
+ */
+ssd1306_cena_t tela_oled;
+ssd1306_elemento_t *oled_ip;
+ssd1306_elemento_t *oled_mqtt;
+ssd1306_elemento_t *oled_ping;
+ssd1306_elemento_t *oled_aviso;
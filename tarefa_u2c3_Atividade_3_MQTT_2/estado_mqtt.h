@@ -3,13 +3,22 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "ssd1306_cena.h"
 
 // Variáveis compartilhadas entre arquivos
 extern uint32_t ultimo_ip_bin;
 extern bool mqtt_iniciado;
 
 // Buffer OLED e área global
-extern uint8_t buffer_oled[];
+extern uint8_t *const buffer_oled;
 extern struct render_area area;
 
+// Tela retida do OLED (criada em setup_init_oled): cada função só troca o texto
+// do seu elemento e o laço principal redesenha o que mudou.
+extern ssd1306_cena_t tela_oled;
+extern ssd1306_elemento_t *oled_ip;      // Linha 0: endereço IP
+extern ssd1306_elemento_t *oled_mqtt;    // Linhas 2-3: status do MQTT
+extern ssd1306_elemento_t *oled_ping;    // Linhas 4-5: retorno do PING
+extern ssd1306_elemento_t *oled_aviso;   // Linhas 6-7: avisos temporários
+
 #endif
@@ -24,6 +24,7 @@
 #include "estado_mqtt.h"
 
 #define INTERVALO_PING_MS 5000  // Intervalo entre envios de "PING" (modificável)
+#define TEMPO_AVISO_MS 3000      // Tempo que um aviso fica na tela
 
 extern void funcao_wifi_nucleo1(void);
 extern void espera_usb();
@@ -53,6 +54,7 @@ int main() {
         tratar_fila();
         inicializar_mqtt_se_preciso();
         enviar_ping_periodico();
+        ssd1306_cena_processar(&tela_oled);  // Redesenha só o que mudou
         sleep_ms(50);
     }
 
@@ -79,22 +81,16 @@ void verificar_fifo(void) {
     if (status > 2 && tentativa != 0x9999) {
         snprintf(mensagem_str, sizeof(mensagem_str),
                  "Status inválido: %u (tentativa %u)", status, tentativa);
-        ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, "Status inválido.");
-        render_on_display(buffer_oled, &area);
-        sleep_ms(3000);
-        oled_clear(buffer_oled, &area);
-        render_on_display(buffer_oled, &area);
+        ssd1306_elemento_temporario(oled_aviso, "Status inválido.", TEMPO_AVISO_MS,
+                                    to_ms_since_boot(get_absolute_time()));
         printf("%s\n", mensagem_str);
         return;
     }
 
     MensagemWiFi msg = {.tentativa = tentativa, .status = status};
     if (!fila_inserir(&fila_wifi, msg)) {
-        ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, "Fila cheia. Descartado.");
-        render_on_display(buffer_oled, &area);
-        sleep_ms(3000);
-        oled_clear(buffer_oled, &area);
-        render_on_display(buffer_oled, &area);
+        ssd1306_elemento_temporario(oled_aviso, "Fila cheia. Descartado.", TEMPO_AVISO_MS,
+                                    to_ms_since_boot(get_absolute_time()));
         printf("Fila cheia. Mensagem descartada.\n");
     }
 }
@@ -118,8 +114,8 @@ void inicializar_mqtt_se_preciso(void) {
 void enviar_ping_periodico(void) {
     if (mqtt_iniciado && absolute_time_diff_us(get_absolute_time(), proximo_envio) <= 0) {
         publicar_mensagem_mqtt("PING");
-        ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, "PING enviado...");
-        render_on_display(buffer_oled, &area);
+        ssd1306_elemento_temporario(oled_aviso, "PING enviado...", TEMPO_MENSAGEM,
+                                    to_ms_since_boot(get_absolute_time()));
         proximo_envio = make_timeout_time_ms(INTERVALO_PING_MS);
     }
 }
@@ -134,13 +130,10 @@ void inicia_hardware(){
 }
 
 void inicia_core1(){
-// Mensagem de inicialização
-    ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, "Núcleo 0");
-    ssd1306_draw_utf8_multiline(buffer_oled, 0, 16, "Iniciando!");
-    render_on_display(buffer_oled, &area);
-    sleep_ms(3000);
-    oled_clear(buffer_oled, &area);
-    render_on_display(buffer_oled, &area);
+// Mensagem de inicialização (some sozinha; o núcleo 1 parte sem esperar)
+    ssd1306_elemento_temporario(oled_aviso, "Núcleo 0\nIniciando!", TEMPO_AVISO_MS,
+                                to_ms_since_boot(get_absolute_time()));
+    ssd1306_cena_processar(&tela_oled);
 
     printf(">> Núcleo 0 iniciado. Aguardando mensagens do núcleo 1...\n");
 
@@ -41,13 +41,12 @@ void tratar_mensagem(MensagemWiFi msg) {
     // ======= NOVA LÓGICA: resposta ao PING =======
     if (msg.tentativa == 0x9999) {
         if (msg.status == 0) {
-            ssd1306_draw_utf8_multiline(buffer_oled, 0, 32, "ACK do PING OK");
+            ssd1306_elemento_texto(oled_ping, "ACK do PING OK");
             set_rgb_pwm(0, 65535, 0); // verde
         } else {
-            ssd1306_draw_utf8_multiline(buffer_oled, 0, 32, "ACK do PING FALHOU");
+            ssd1306_elemento_texto(oled_ping, "ACK do PING FALHOU");
             set_rgb_pwm(65535, 0, 0); // vermelho
         }
-        render_on_display(buffer_oled, &area);
         return;
     }
 
@@ -74,11 +73,8 @@ void tratar_mensagem(MensagemWiFi msg) {
     char linha_status[32];
     snprintf(linha_status, sizeof(linha_status), "Status do Wi-Fi : %s", descricao);
 
-    ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, linha_status);
-    render_on_display(buffer_oled, &area);
-    sleep_ms(3000);
-    oled_clear(buffer_oled, &area);
-    render_on_display(buffer_oled, &area);
+    // Aviso por 3 s, sem bloquear o núcleo 0 (o laço principal o apaga)
+    ssd1306_elemento_temporario(oled_aviso, linha_status, 3000, to_ms_since_boot(get_absolute_time()));
 
     printf("[NÚCLEO 0] Status: %s (%s)\n", descricao, msg.tentativa > 0 ? descricao : "evento");
 }
@@ -97,9 +93,7 @@ void tratar_ip_binario(uint32_t ip_bin) {
 
     snprintf(ip_str, sizeof(ip_str), "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3]);
 
-    oled_clear(buffer_oled, &area);
-    ssd1306_draw_utf8_string(buffer_oled, 0, 0, ip_str);
-    render_on_display(buffer_oled, &area);
+    ssd1306_elemento_texto(oled_ip, ip_str);
 
     printf("[NÚCLEO 0] Endereço IP: %s\n", ip_str);
     ultimo_ip_bin = ip_bin;
@@ -107,11 +101,14 @@ void tratar_ip_binario(uint32_t ip_bin) {
 
 /**
  * @brief Exibe status textual do MQTT no OLED e terminal.
+ *
+ * Chamada pelos callbacks do lwIP: só troca o texto do elemento, sem acessar o
+ * I2C; o laço principal envia a linha na próxima volta.
  */
 void exibir_status_mqtt(const char *texto) {
-    ssd1306_draw_utf8_string(buffer_oled, 0, 16, "MQTT: ");
-    ssd1306_draw_utf8_string(buffer_oled, 40, 16, texto);
-    render_on_display(buffer_oled, &area);
+    char linha[SSD1306_ELEMENTO_TEXTO_MAX];
+    snprintf(linha, sizeof(linha), "MQTT: %s", texto);
+    ssd1306_elemento_texto(oled_mqtt, linha);
 
     printf("[MQTT] %s\n", texto);
 }
@@ -2,6 +2,12 @@
 #define DIGITOS_GRANDES_UTILS_H
 
 #include <stdint.h>
+#include "ssd1306_grande.h"
+
+#define DIGITOS_OFFSET_VERTICAL 2   // começa na 3ª página (pixel 16)
+
+// Dígitos 0 a 9 de numeros_grandes[], para o número grande (ssd1306_grande_t)
+extern const ssd1306_glifo_grande_t digitos_grandes[10];
 
 void exibir_digito_grande(uint8_t *buffer, uint8_t x, const uint8_t *bitmap);
 void exibir_double_dot(uint8_t *buffer, uint8_t x);
@@ -1,8 +0,0 @@
-#ifndef SSD1306_BITMAP_H
-#define SSD1306_BITMAP_H
-
-#include "ssd1306_i2c.h"
-
-void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
-
-#endif // SSD1306_BITMAP_H
@@ -1,10 +1,13 @@
 #include "ssd1306_i2c.h"
 #include "digitos_grandes_utils.h"
+#include "ssd1306_utils.h"
+#include "ssd1306_init.h"
+#include "numeros_grandes.h"
+#include "ssd1306_sem_heap.h"
 
 #define DIGITO_LARGURA         25   // colunas
 #define DIGITO_ALTURA_TOTAL    8    // páginas no bitmap
 #define DIGITO_ALTURA_USADA    6    // páginas visíveis (da página 2 a 7)
-#define DIGITOS_OFFSET_VERTICAL 2   // começa na 3ª página (pixel 16)
 #define DOUBLE_DOT_LARGURA         2   // colunas
 #define DOUBLE_DOT_ALTURA_TOTAL    8   // altura total do bitmap em páginas
 #define DOUBLE_DOT_ALTURA_USADA    2   // páginas visíveis (ex: página 2 e 3)
@@ -19,16 +22,21 @@ const uint8_t ponto_decimal[2] = {
     0x18, 0x18  // dois pixels centrais ligados nas duas colunas
 };
 
+// Cada bitmap de numeros_grandes[] já guarda as colunas em bytes de página
+// (coluna * 8 + página): o glifo aponta direto para as páginas visíveis.
+#define DIGITO_GRANDE(d) { DIGITO_LARGURA, DIGITO_ALTURA_USADA, DIGITO_ALTURA_TOTAL, \
+                           numeros_grandes[d] + DIGITOS_OFFSET_VERTICAL }
+
+const ssd1306_glifo_grande_t digitos_grandes[10] = {
+    DIGITO_GRANDE(0), DIGITO_GRANDE(1), DIGITO_GRANDE(2), DIGITO_GRANDE(3), DIGITO_GRANDE(4),
+    DIGITO_GRANDE(5), DIGITO_GRANDE(6), DIGITO_GRANDE(7), DIGITO_GRANDE(8), DIGITO_GRANDE(9),
+};
+
 void exibir_digito_grande(uint8_t *buffer, uint8_t x, const uint8_t *bitmap) {
-    for (uint8_t col = 0; col < DIGITO_LARGURA; col++) {
-        for (uint8_t page = 0; page < DIGITO_ALTURA_USADA; page++) {
-            int index = col * DIGITO_ALTURA_TOTAL + (page + DIGITOS_OFFSET_VERTICAL);
-            int pos = (page + DIGITOS_OFFSET_VERTICAL) * ssd1306_width + (x + col);
-            if (pos < ssd1306_buffer_length) {
-                buffer[pos] = bitmap[index];
-            }
-        }
-    }
+    ssd1306_glifo_grande_t glifo = {
+        DIGITO_LARGURA, DIGITO_ALTURA_USADA, DIGITO_ALTURA_TOTAL, bitmap + DIGITOS_OFFSET_VERTICAL
+    };
+    ssd1306_dev_glifo_grande(ssd1306_padrao_quadro(buffer), x, DIGITOS_OFFSET_VERTICAL, &glifo);
 }
 
 void exibir_double_dot(uint8_t *buffer, uint8_t x) {
@@ -39,10 +47,12 @@ void exibir_double_dot(uint8_t *buffer, uint8_t x) {
     // Ponto inferior: página 5 (pixel 40)
     buffer[5 * ssd1306_width + x]     = double_dot[2];
     buffer[5 * ssd1306_width + x + 1] = double_dot[3];
+    ssd1306_marcar_sujo(x, 4 * 8, x + 1, 6 * 8 - 1);
 }
 
 void exibir_ponto_decimal(uint8_t *buffer, uint8_t x) {
     // Página 7 = última (pixels 56 a 63)
     buffer[7 * ssd1306_width + x]     = ponto_decimal[0];
     buffer[7 * ssd1306_width + x + 1] = ponto_decimal[1];
+    ssd1306_marcar_sujo(x, 7 * 8, x + 1, 8 * 8 - 1);
 }
\ No newline at end of file
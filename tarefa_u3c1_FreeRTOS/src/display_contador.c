@@ -11,9 +11,36 @@
 // Declaração da fila que é criada no main.c
 extern QueueHandle_t fila_oled;
 
+// Tarefa a acordar quando o DMA terminar de entregar um quadro ao I2C.
+static TaskHandle_t tarefa_oled = NULL;
+static bool quadro_em_voo = false;
+#define ESPERA_QUADRO_MS 100
+
+// Colunas da dezena e da unidade, centralizadas no display
+static const int16_t colunas_contador[2] = {30, 70};
+
+// Callback do transporte assíncrono (roda no handler do DMA).
+static void quadro_enviado(void *contexto) {
+    BaseType_t acordar = pdFALSE;
+    vTaskNotifyGiveFromISR(tarefa_oled, &acordar);
+    portYIELD_FROM_ISR(acordar);
+}
+
+// Envia o quadro por DMA. Antes de montar o lote, a tarefa dorme até o lote anterior
+// sair, então o próximo quadro é desenhado enquanto o anterior ainda está no barramento.
+// A espera tem limite: se o display não responder, o callback não vem, e é
+// ssd1306_flush_async (pelo prazo do lote) que descarta o lote e devolve false.
+static void enviar_quadro(uint8_t *buffer) {
+    if (quadro_em_voo) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ESPERA_QUADRO_MS));
+    }
+    quadro_em_voo = ssd1306_flush_async(buffer, quadro_enviado, NULL);
+}
+
 void tarefa_display_contador(void *p) {
-    // Buffer para o display OLED e configuração da área de renderização
-    uint8_t buffer[ssd1306_buffer_length];
+    // Framebuffer do display OLED (com o byte de controle reservado) e área de renderização
+    ssd1306_framebuffer_t quadro = SSD1306_FRAMEBUFFER_INIT;
+    uint8_t *buffer = quadro.pixels;
     struct render_area area;
 
     // Inicializa o display I2C (i2c1 nos pinos GPIO14 - SDA, GPIO15 - SCL)
@@ -21,6 +48,14 @@ void tarefa_display_contador(void *p) {
     oled_clear(buffer, &area);
     render_on_display(buffer, &area);
 
+    // A partir daqui as atualizações saem pelo DMA, sem bloquear a tarefa.
+    tarefa_oled = xTaskGetCurrentTaskHandle();
+    ssd1306_async_init();
+
+    // Número grande do contador: a cada segundo só o dígito que mudou é redesenhado
+    ssd1306_grande_t contador;
+    ssd1306_grande_iniciar(&contador, ssd1306_padrao_quadro(buffer), DIGITOS_OFFSET_VERTICAL);
+
     int tempo_recebido = 0;
 
     while (1) {
@@ -29,17 +64,18 @@ void tarefa_display_contador(void *p) {
             
             // Inicia a contagem regressiva no display
             for (int i = tempo_recebido; i >= 1; i--) {
-                oled_clear(buffer, &area);
-
                 // Extrai dezena e unidade para exibir
                 int dezena  = (i / 10) % 10;
                 int unidade = i % 10;
                 
                 // Exibe os dígitos grandes no centro do display
-                exibir_digito_grande(buffer, 30, numeros_grandes[dezena]);
-                exibir_digito_grande(buffer, 70, numeros_grandes[unidade]);
+                const ssd1306_glifo_grande_t *digitos[2] = {
+                    &digitos_grandes[dezena], &digitos_grandes[unidade]
+                };
+                ssd1306_grande_exibir(&contador, colunas_contador, digitos, 2);
 
-                render_on_display(buffer, &area);
+                // Envia só o retângulo dos dígitos que mudaram (em geral, só a unidade)
+                enviar_quadro(buffer);
                 
                 // Espera 1 segundo antes de atualizar o display novamente
                 vTaskDelay(pdMS_TO_TICKS(1000));
@@ -47,7 +83,8 @@ void tarefa_display_contador(void *p) {
 
             // Limpa o display ao final da contagem
             oled_clear(buffer, &area);
-            render_on_display(buffer, &area);
+            ssd1306_grande_esquecer(&contador);
+            enviar_quadro(buffer);
         }
     }
 }
\ No newline at end of file
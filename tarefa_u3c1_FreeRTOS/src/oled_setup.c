@@ -12,8 +12,8 @@ void setup_display(i2c_inst_t *porta, uint sda, uint scl, uint freq_khz,
     gpio_pull_up(sda);
     gpio_pull_up(scl);
 
-    // Inicializa o display
-    ssd1306_init();
+    // Inicializa o display na porta recebida
+    ssd1306_init_i2c(porta, ssd1306_i2c_address);
 
     // Configura a área de renderização
     area->start_column = 0;
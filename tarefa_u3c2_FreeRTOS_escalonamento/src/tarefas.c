@@ -1,6 +1,6 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
-#include "hardware/adc.h"
+#include "adc_amostrador.h"
 #include "FreeRTOS.h"
 #include "task.h"
 #include "semphr.h"
@@ -60,12 +60,9 @@ void task_monitor_joystick(void *params) {
         printf("[TAREFA 3] Sinal recebido. Iniciando Monitor Task...\n");
         // xSemaphoreGive(self_test_sem);
         while (true) {
-            // Seleciona e lê o canal ADC do eixo Y do joystick.
-            adc_select_input(0);
-            float voltageY = adc_read() * ADC_CONVERSION_FACTOR;
-            // Seleciona e lê o canal ADC do eixo X do joystick.
-            adc_select_input(1);
-            float voltageX = adc_read() * ADC_CONVERSION_FACTOR;
+            // Última amostra (média de 10 ms) de cada eixo do joystick.
+            float voltageY = adc_amostrador_ultimo(JOY_Y_ADC_CANAL) * ADC_CONVERSION_FACTOR;
+            float voltageX = adc_amostrador_ultimo(JOY_X_ADC_CANAL) * ADC_CONVERSION_FACTOR;
             // Imprime os valores de tensão lidos no terminal.
             printf("JOYSTICK -> X: %.2f V, Y: %.2f V\n", voltageX, voltageY);
 
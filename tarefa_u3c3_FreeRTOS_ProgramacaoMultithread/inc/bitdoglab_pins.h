@@ -23,8 +23,11 @@
 // Tarefa 1 & 3: Joystick Analógico
 #define JOY_X_ADC_PIN 27  // ADC1
 #define JOY_Y_ADC_PIN 26  // ADC0
+#define JOY_X_ADC_CANAL 1
+#define JOY_Y_ADC_CANAL 0
 
 // Tarefa 1: Microfone
 #define MIC_ADC_PIN 28    // ADC2
+#define MIC_ADC_CANAL 2
 
 #endif
\ No newline at end of file
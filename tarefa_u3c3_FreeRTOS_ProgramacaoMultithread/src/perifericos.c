@@ -1,6 +1,6 @@
 #include <stdio.h>
 #include "pico/stdlib.h"
-#include "hardware/adc.h"
+#include "adc_amostrador.h"
 #include "FreeRTOS.h"
 #include "task.h"
 #include "bitdoglab_pins.h"
@@ -9,6 +9,10 @@
 // Constante para converter o valor bruto do ADC (0-4095) em tensão (0-3.3V).
 const float ADC_CONVERSION_FACTOR = 3.3f / (1 << 12);
 
+// Conversões por segundo de cada canal; o joystick guarda a média de 2^3 (100 Hz).
+#define ADC_TAXA_HZ 800
+#define JOY_LOG2_DECIMACAO 3
+
 // Variável estática para armazenar o número do "slice" do PWM usado pelo buzzer.
 // 'static' a torna visível apenas dentro deste arquivo.
 static uint slice_num;
@@ -28,12 +32,20 @@ void init_perifericos() {
     gpio_init(BTN_B_PIN); gpio_set_dir(BTN_B_PIN, GPIO_IN); gpio_pull_up(BTN_B_PIN);
     gpio_init(BTN_JOY_SW_PIN); gpio_set_dir(BTN_JOY_SW_PIN, GPIO_IN); gpio_pull_up(BTN_JOY_SW_PIN);
 
-    // Habilita o hardware do conversor analógico-digital.
-    adc_init();
-    // Associa os pinos físicos do joystick e microfone à função de ADC.
-    adc_gpio_init(JOY_X_ADC_PIN);
-    adc_gpio_init(JOY_Y_ADC_PIN);
-    adc_gpio_init(MIC_ADC_PIN);
+    // Inicia o amostrador do ADC: joystick e microfone convertidos em rodízio,
+    // sem que as tarefas selecionem canais ou esperem conversões.
+    static const adc_decimacao_t decimacao[ADC_AMOSTRADOR_CANAIS] = {
+        [JOY_Y_ADC_CANAL] = { .ordem = 1, .log2_fator = JOY_LOG2_DECIMACAO },
+        [JOY_X_ADC_CANAL] = { .ordem = 1, .log2_fator = JOY_LOG2_DECIMACAO },
+    };
+    adc_amostrador_iniciar(ADC_MASCARA(JOY_Y_ADC_CANAL) | ADC_MASCARA(JOY_X_ADC_CANAL) |
+                           ADC_MASCARA(MIC_ADC_CANAL), ADC_TAXA_HZ, decimacao);
+
+    // Antes da primeira amostra a leitura dá 0; as tarefas já começam com valores reais.
+    while (!adc_amostrador_tem_amostra(JOY_Y_ADC_CANAL) || !adc_amostrador_tem_amostra(JOY_X_ADC_CANAL) ||
+           !adc_amostrador_tem_amostra(MIC_ADC_CANAL)) {
+        sleep_ms(1);
+    }
 }
 
 // Acende e apaga sequencialmente os LEDs R, G e B para um teste visual.
@@ -58,14 +70,12 @@ void test_botoes() {
 void test_joystick_analog() {
     printf("  [TESTE] Testando Joystick Analogico...\n");
 
-    // Seleciona o canal 0 do ADC (conectado ao eixo Y).
-    adc_select_input(0);
-    uint16_t y_raw = adc_read();
+    // Última amostra do canal 0 do ADC (conectado ao eixo Y).
+    uint16_t y_raw = adc_amostrador_ultimo(JOY_Y_ADC_CANAL);
     printf("    - Eixo Y (ADC0): %.2f V\n", y_raw * ADC_CONVERSION_FACTOR);
 
-    // Seleciona o canal 1 do ADC (conectado ao eixo X).
-    adc_select_input(1);
-    uint16_t x_raw = adc_read();
+    // Última amostra do canal 1 do ADC (conectado ao eixo X).
+    uint16_t x_raw = adc_amostrador_ultimo(JOY_X_ADC_CANAL);
     printf("    - Eixo X (ADC1): %.2f V\n", x_raw * ADC_CONVERSION_FACTOR);
     
     printf("  [OK] Joystick Analogico testado.\n");
@@ -75,9 +85,8 @@ void test_joystick_analog() {
 void test_microfone() {
     printf("  [TESTE] Testando Microfone...\n");
 
-    // Seleciona o canal 2 do ADC (conectado ao microfone).
-    adc_select_input(2);
-    uint16_t mic_raw = adc_read();
+    // Última amostra do canal 2 do ADC (conectado ao microfone).
+    uint16_t mic_raw = adc_amostrador_ultimo(MIC_ADC_CANAL);
     printf("    - Leitura Microfone (ADC2): %.2f V\n", mic_raw * ADC_CONVERSION_FACTOR);
     
     printf("  [OK] Microfone testado.\n");
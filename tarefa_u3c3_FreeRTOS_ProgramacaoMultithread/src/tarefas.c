@@ -3,7 +3,7 @@
 //---------------------------------------------------------------------------------------------//
 #include <stdio.h>
 #include "pico/stdlib.h"
-#include "hardware/adc.h"
+#include "adc_amostrador.h"
 #include "FreeRTOS.h"
 #include "task.h"
 
@@ -21,10 +21,8 @@ void task_leitura_eixos(void *params) {
     msg.type = JOYSTICK_DATA;
 
     while (true) {
-        adc_select_input(0); // Canal do eixo Y
-        msg.y = adc_read();
-        adc_select_input(1); // Canal do eixo X
-        msg.x = adc_read();
+        msg.y = adc_amostrador_ultimo(JOY_Y_ADC_CANAL); // Canal do eixo Y
+        msg.x = adc_amostrador_ultimo(JOY_X_ADC_CANAL); // Canal do eixo X
 
         // Envia a mensagem para a fila. Não bloqueia se a fila estiver cheia.
         xQueueSend(xQueueEventos, &msg, 0);